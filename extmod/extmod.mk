@@ -24,6 +24,8 @@ SRC_EXTMOD_C += \
 	extmod/vfs_posix.c \
 	extmod/vfs_posix_file.c \
 	extmod/vfs_reader.c \
+	extmod/vfs_rom.c \
+	extmod/vfs_rom_file.c \
 	shared/libc/abort_.c \
 	shared/libc/printf.c \
 
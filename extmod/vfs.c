@@ -46,6 +46,9 @@
 #include "extmod/vfs_posix.h"
 #endif
 
+#if MICROPY_VFS_ROM
+#include "extmod/vfs_rom.h"
+#endif
 
 #if CIRCUITPY_SDCARDIO
 #include "shared-module/sdcardio/__init__.h"
@@ -125,6 +128,14 @@ static mp_obj_t mp_vfs_proxy_call(mp_vfs_mount_t *vfs, qstr meth_name, size_t n_
         // can't do operation on root dir
         mp_raise_OSError(MP_EPERM);
     }
+    #if MICROPY_VFS_IMPORT_CACHE
+    // Anything but a method that only reads might change a directory
+    if (meth_name != MP_QSTR_ilistdir && meth_name != MP_QSTR_stat && meth_name != MP_QSTR_statvfs
+        && meth_name != MP_QSTR_getcwd
+        && !(meth_name == MP_QSTR_open && strpbrk(mp_obj_str_get_str(args[1]), "wax+") == NULL)) {
+        mp_vfs_import_cache_invalidate();
+    }
+    #endif
     mp_obj_t meth[2 + PROXY_MAX_ARGS];
     mp_load_method(vfs->obj, meth_name, meth);
     if (args != NULL) {
@@ -133,6 +144,191 @@ static mp_obj_t mp_vfs_proxy_call(mp_vfs_mount_t *vfs, qstr meth_name, size_t n_
     return mp_call_method_n_kw(n_args, 0, meth);
 }
 
+#if MICROPY_VFS_IMPORT_CACHE
+
+// An import stats every candidate, such as foo, foo.py and foo.mpy, in each
+// sys.path directory in turn, and most of those files don't exist. To answer
+// those stats without asking the filesystem, the names in each directory that
+// is looked in are listed once and kept as an open addressed table of hashes.
+// A name whose hash isn't there doesn't exist; any other name is stat'ed as
+// usual. Names are hashed in lower case, because FAT ignores case.
+typedef struct _mp_vfs_dir_index_t {
+    mp_obj_t vfs_obj; // only compared, so the index doesn't need to be scanned
+    uint32_t generation;
+    uint16_t mask; // the size of the table, less one
+    uint16_t path_len;
+    bool complete; // false if the directory couldn't be listed
+    uint32_t table[]; // followed by the path of the directory within the VFS
+} mp_vfs_dir_index_t;
+
+// Changed whenever a directory might have changed. It may be changed from
+// outside the VM, such as by a USB host writing to the filesystem.
+static volatile uint32_t dir_index_generation;
+static uint8_t dir_index_next;
+
+void mp_vfs_import_cache_invalidate(void) {
+    dir_index_generation += 1;
+}
+
+uint32_t mp_vfs_import_cache_generation(void) {
+    return dir_index_generation;
+}
+
+static uint32_t dir_index_hash(const char *name, size_t len) {
+    uint32_t hash = 5381;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash * 33) ^ unichar_tolower((unsigned char)name[i]);
+    }
+    // zero marks an empty slot
+    return hash == 0 ? 1 : hash;
+}
+
+static bool dir_index_contains(const mp_vfs_dir_index_t *index, uint32_t hash) {
+    for (size_t i = hash & index->mask; index->table[i] != 0; i = (i + 1) & index->mask) {
+        if (index->table[i] == hash) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static mp_vfs_dir_index_t *dir_index_new(mp_obj_t vfs_obj, const char *dir, size_t dir_len,
+    uint32_t generation, const uint32_t *hashes, size_t count, bool complete) {
+    size_t size = 4;
+    while (size < 2 * count) {
+        size *= 2;
+    }
+    if (size > 0x10000) {
+        return NULL;
+    }
+    mp_vfs_dir_index_t *index = m_malloc_maybe_without_collect(
+        sizeof(mp_vfs_dir_index_t) + size * sizeof(uint32_t) + dir_len);
+    if (index == NULL) {
+        return NULL;
+    }
+    index->vfs_obj = vfs_obj;
+    index->generation = generation;
+    index->mask = size - 1;
+    index->path_len = dir_len;
+    index->complete = complete;
+    memset(index->table, 0, size * sizeof(uint32_t));
+    for (size_t i = 0; i < count; i++) {
+        if (!dir_index_contains(index, hashes[i])) {
+            size_t j = hashes[i] & index->mask;
+            while (index->table[j] != 0) {
+                j = (j + 1) & index->mask;
+            }
+            index->table[j] = hashes[i];
+        }
+    }
+    memcpy(&index->table[size], dir, dir_len);
+    return index;
+}
+
+// List a directory into a new index. A directory that doesn't exist is indexed
+// as empty; one that can't be listed for another reason is indexed as
+// incomplete, so every stat in it goes to the filesystem.
+static mp_vfs_dir_index_t *dir_index_build(mp_vfs_mount_t *vfs, const char *dir, size_t dir_len) {
+    // Take the generation first, so a change made during the listing is seen next time
+    uint32_t generation = dir_index_generation;
+    size_t count = 0;
+    size_t alloc = 16;
+    uint32_t *hashes = m_new(uint32_t, alloc);
+    bool complete = true;
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // The current directory is listed with ""
+        mp_obj_t dir_obj = mp_obj_new_str(dir, dir_len);
+        mp_obj_t iter = mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &dir_obj);
+        mp_obj_t entry;
+        while ((entry = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+            size_t len;
+            const char *name = mp_obj_str_get_data(mp_obj_subscr(entry, MP_OBJ_NEW_SMALL_INT(0), MP_OBJ_SENTINEL), &len);
+            if (count == alloc) {
+                hashes = m_renew(uint32_t, hashes, alloc, alloc * 2);
+                alloc *= 2;
+            }
+            hashes[count++] = dir_index_hash(name, len);
+        }
+        nlr_pop();
+    } else {
+        mp_obj_t exc = MP_OBJ_FROM_PTR(nlr.ret_val);
+        if (!mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(exc)), MP_OBJ_FROM_PTR(&mp_type_OSError))) {
+            nlr_jump(nlr.ret_val);
+        }
+        count = 0;
+        complete = dir_len != 0 && mp_obj_exception_get_value(exc) == MP_OBJ_NEW_SMALL_INT(MP_ENOENT);
+    }
+
+    mp_vfs_dir_index_t *index = dir_index_new(vfs->obj, dir, dir_len, generation, hashes, count, complete);
+    m_del(uint32_t, hashes, alloc);
+    return index;
+}
+
+// Return false if the path is known not to exist
+static bool dir_index_may_exist(mp_vfs_mount_t *vfs, const char *path) {
+    #if MICROPY_VFS_ROM
+    // A ROM filesystem is already in memory, so an index isn't worth the RAM
+    if (mp_obj_is_type(vfs->obj, &mp_type_vfs_rom)) {
+        return true;
+    }
+    #endif
+    #if MICROPY_VFS_POSIX
+    // Other processes change the host's directories without going through the
+    // VM, so an index of one would never be invalidated
+    if (mp_obj_is_type(vfs->obj, &mp_type_vfs_posix)) {
+        return true;
+    }
+    #endif
+    const char *leaf = strrchr(path, '/');
+    size_t dir_len = 0;
+    if (leaf == NULL) {
+        leaf = path;
+    } else {
+        // The root directory is "/", while "" is the current directory
+        dir_len = leaf == path ? 1 : leaf - path;
+        leaf += 1;
+    }
+    size_t leaf_len = strlen(leaf);
+    if (leaf_len == 0) {
+        return true;
+    }
+    for (size_t i = 0; i < leaf_len; i++) {
+        // FAT ignores the case of other characters too, which isn't worth doing here
+        if ((unsigned char)leaf[i] >= 0x80) {
+            return true;
+        }
+    }
+
+    mp_vfs_dir_index_t **indexes = MP_STATE_VM(vfs_dir_index);
+    size_t slot = MICROPY_VFS_IMPORT_CACHE_SIZE;
+    for (size_t i = 0; i < MICROPY_VFS_IMPORT_CACHE_SIZE; i++) {
+        mp_vfs_dir_index_t *index = indexes[i];
+        if (index != NULL && index->vfs_obj == vfs->obj && index->path_len == dir_len
+            && memcmp(&index->table[index->mask + 1], path, dir_len) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot == MICROPY_VFS_IMPORT_CACHE_SIZE || indexes[slot]->generation != dir_index_generation) {
+        mp_vfs_dir_index_t *index = dir_index_build(vfs, path, dir_len);
+        if (slot == MICROPY_VFS_IMPORT_CACHE_SIZE) {
+            slot = dir_index_next;
+            dir_index_next = (dir_index_next + 1) % MICROPY_VFS_IMPORT_CACHE_SIZE;
+        }
+        indexes[slot] = index;
+        if (index == NULL) {
+            return true;
+        }
+    }
+
+    mp_vfs_dir_index_t *index = indexes[slot];
+    return !index->complete || dir_index_contains(index, dir_index_hash(leaf, leaf_len));
+}
+
+#endif
+
 mp_import_stat_t mp_vfs_import_stat(const char *path) {
     const char *path_out;
     mp_vfs_mount_t *vfs = mp_vfs_lookup_path(path, &path_out);
@@ -144,6 +340,13 @@ mp_import_stat_t mp_vfs_import_stat(const char *path) {
     const mp_obj_type_t *type = mp_obj_get_type(vfs->obj);
     if (MP_OBJ_TYPE_HAS_SLOT(type, protocol)) {
         const mp_vfs_proto_t *proto = MP_OBJ_TYPE_GET_SLOT(type, protocol);
+        #if MICROPY_VFS_IMPORT_CACHE
+        // Only the built in filesystems are indexed, because a filesystem written
+        // in Python might change without telling.
+        if (!dir_index_may_exist(vfs, path_out)) {
+            return MP_IMPORT_STAT_NO_EXIST;
+        }
+        #endif
         return proto->import_stat(MP_OBJ_TO_PTR(vfs->obj), path_out);
     }
 
@@ -606,5 +809,8 @@ int mp_vfs_mount_romfs_protected(void) {
 
 MP_REGISTER_ROOT_POINTER(struct _mp_vfs_mount_t *vfs_cur);
 MP_REGISTER_ROOT_POINTER(struct _mp_vfs_mount_t *vfs_mount_table);
+#if MICROPY_VFS_IMPORT_CACHE
+MP_REGISTER_ROOT_POINTER(struct _mp_vfs_dir_index_t *vfs_dir_index[MICROPY_VFS_IMPORT_CACHE_SIZE]);
+#endif
 
 #endif // MICROPY_VFS
@@ -112,6 +112,16 @@ mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t
 
 mp_vfs_mount_t *mp_vfs_lookup_path(const char *path, const char **path_out);
 mp_import_stat_t mp_vfs_import_stat(const char *path);
+#if MICROPY_VFS_IMPORT_CACHE
+// Forget which files imports found missing, because a filesystem has changed
+void mp_vfs_import_cache_invalidate(void);
+// Changes whenever the import cache is invalidated, so that other answers about
+// the filesystem can be kept until then
+uint32_t mp_vfs_import_cache_generation(void);
+#else
+static inline void mp_vfs_import_cache_invalidate(void) {
+}
+#endif
 mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 mp_obj_t mp_vfs_umount(mp_obj_t mnt_in);
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
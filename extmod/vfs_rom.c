@@ -52,6 +52,11 @@
 //       of the directory (including optional metadata).
 // - 5 = a file: payload contains a varuint which is the length of the filename in bytes
 //       then the name, then optional nested records.
+// - 6 = a directory index: payload contains a varuint which is the number of entries N,
+//       a varuint which is the size W of each entry in bytes (1 to 4), then N entries.
+//       Each entry is a big-endian offset, relative to the end of the index record, of
+//       a directory or file record.  The entries are sorted by the names of those
+//       records, compared as bytes.
 //
 // Remarks:
 // - A varuint can be padded if needed by prepending with one or more 0x80 bytes.  This
@@ -61,13 +66,15 @@
 // - File data can be optionally aligned using padding records and/or indirect data
 //   records.
 // - There is no limit to the size of directory/file names or file data.
+// - A directory index is optional.  If present, it must come before the directory and
+//   file records of its directory (or of the top-level filesystem), and it must list
+//   all of them.  Names are then found with a binary search instead of a linear scan.
 //
 // Unknown record types must be skipped over.  They may in the future add optional
 // features, while still retaining backwards compatibility.  Such features may be:
 // - Alignment requirements of the ROMFS record.
 // - Timestamps on directories/files.
 // - A precomputed hash of a file, or other metadata.
-// - An optimised lookup table indexing the directory hierarchy.
 
 #include <string.h>
 
@@ -91,6 +98,7 @@
 #define ROMFS_RECORD_KIND_DATA_POINTER (3)
 #define ROMFS_RECORD_KIND_DIRECTORY (4)
 #define ROMFS_RECORD_KIND_FILE (5)
+#define ROMFS_RECORD_KIND_DIRECTORY_INDEX (6)
 #define ROMFS_RECORD_KIND_FILESYSTEM (0x14a6b1)
 
 typedef mp_uint_t record_kind_t;
@@ -170,6 +178,58 @@ static int extract_data(mp_obj_vfs_rom_t *self, const uint8_t *fs, const uint8_t
     return -MP_EIO;
 }
 
+// Searches a directory index for the record named `name`.  The index payload is from
+// `fs` to `fs_next`, and the records it points to are from `fs_next` to `fs_top`.
+// Returns 0 and the record in `record_out` if found, -MP_ENOENT if there is no such
+// record, or -MP_EIO if the index is corrupt.
+static int search_directory_index(const uint8_t *fs, const uint8_t *fs_next, const uint8_t *fs_top, const char *name, size_t name_len, const uint8_t **record_out) {
+    mp_uint_t num_entries;
+    mp_uint_t entry_size;
+    if (mp_decode_uint_checked(&fs, fs_next, &num_entries) != 0
+        || mp_decode_uint_checked(&fs, fs_next, &entry_size) != 0
+        || entry_size < 1 || entry_size > 4
+        || (mp_uint_t)(fs_next - fs) / entry_size != num_entries) {
+        return -MP_EIO;
+    }
+    size_t lo = 0;
+    size_t hi = num_entries;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const uint8_t *entry = fs + mid * entry_size;
+        mp_uint_t offset = 0;
+        for (size_t i = 0; i < entry_size; ++i) {
+            offset = offset << 8 | entry[i];
+        }
+        if (offset >= (mp_uint_t)(fs_top - fs_next)) {
+            return -MP_EIO;
+        }
+        const uint8_t *record = fs_next + offset;
+        const uint8_t *record_name = record;
+        const uint8_t *record_next;
+        record_kind_t record_kind = extract_record(&record_name, &record_next, fs_top);
+        mp_uint_t record_name_len;
+        if ((record_kind != ROMFS_RECORD_KIND_DIRECTORY && record_kind != ROMFS_RECORD_KIND_FILE)
+            || record_next > fs_top
+            || mp_decode_uint_checked(&record_name, record_next, &record_name_len) != 0
+            || record_name_len > (mp_uint_t)(record_next - record_name)) {
+            return -MP_EIO;
+        }
+        int cmp = memcmp(name, record_name, MIN(name_len, record_name_len));
+        if (cmp == 0) {
+            cmp = (name_len > record_name_len) - (name_len < record_name_len);
+        }
+        if (cmp == 0) {
+            *record_out = record;
+            return 0;
+        } else if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return -MP_ENOENT;
+}
+
 // Searches for `path` in the filesystem.
 // `path` must be null-terminated.
 mp_import_stat_t mp_vfs_rom_search_filesystem(mp_obj_vfs_rom_t *self, const char *path, size_t *size_out, const uint8_t **data_out) {
@@ -223,6 +283,21 @@ mp_import_stat_t mp_vfs_rom_search_filesystem(mp_obj_vfs_rom_t *self, const char
                 // Skip this directory/file record.
                 fs = fs_next;
             }
+        } else if (record_kind == ROMFS_RECORD_KIND_DIRECTORY_INDEX) {
+            // Look up the next component of the path in the index.
+            const char *slash = memchr(path, '/', path_len);
+            size_t name_len = slash == NULL ? path_len : (size_t)(slash - path);
+            const uint8_t *record;
+            int ret = search_directory_index(fs, fs_next, fs_top, path, name_len, &record);
+            if (ret == 0) {
+                // Continue at the record, which will match.
+                fs = record;
+            } else if (ret == -MP_ENOENT) {
+                return MP_IMPORT_STAT_NO_EXIST;
+            } else {
+                // Corrupt index, so ignore it and scan the records that follow.
+                fs = fs_next;
+            }
         } else {
             // Skip this record.
             fs = fs_next;
@@ -389,6 +389,11 @@ void audio_dma_evsys_handler(void) {
         // of which buffer to fill here appears correct.
         DmacDescriptor *next_descriptor =
             (DmacDescriptor *)dma_write_back_descriptor(dma->dma_channel)->DESCADDR.reg;
+        // The buffer from the last block hasn't been refilled yet, so it will be
+        // played again with stale data.
+        if (dma->buffer_to_load != NO_BUFFER_TO_LOAD && dma->sample != NULL) {
+            audiosample_record_underrun(dma->sample);
+        }
         if (next_descriptor == dma->descriptor[0]) {
             dma->buffer_to_load = 0;
         } else if (next_descriptor == dma->descriptor[1]) {
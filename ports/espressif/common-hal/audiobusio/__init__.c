@@ -107,7 +107,13 @@ static void i2s_callback_fun(void *self_in) {
 
 static bool i2s_event_interrupt(i2s_chan_handle_t handle, i2s_event_data_t *event, void *self_in) {
     i2s_t *self = self_in;
-    self->underrun = self->underrun || self->next_buffer != NULL;
+    // The previous free buffer wasn't filled in time, so the DMA played stale data
+    if (self->next_buffer != NULL) {
+        self->underrun = true;
+        if (self->sample != NULL) {
+            audiosample_record_underrun(self->sample);
+        }
+    }
     self->next_buffer = *(int16_t **)event->data;
     self->next_buffer_size = event->size;
     background_callback_add(&self->callback, i2s_callback_fun, self_in);
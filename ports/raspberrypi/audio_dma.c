@@ -8,6 +8,7 @@
 
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
+#include "shared-module/audiocore/__init__.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "supervisor/background_callback.h"
@@ -530,6 +531,10 @@ static void dma_callback_fun(void *arg) {
     if (first_filled_channel != NUM_DMA_CHANNELS && (dma->channels_to_load_mask != 0 || filled_count == 2)) {
         dma_channel_start(first_filled_channel);
     }
+    // With both buffers played before either was refilled, output stopped for a while.
+    if (filled_count == 2 && dma->sample != NULL) {
+        audiosample_record_underrun(dma->sample);
+    }
 }
 
 void __not_in_flash_func(isr_dma_0)(void) {
@@ -114,6 +114,8 @@ typedef long mp_off_t;
 #define MICROPY_ENABLE_GC           (1)
 // CIRCUITPY-CHANGE
 #define MICROPY_ENABLE_SELECTIVE_COLLECT (1)
+#define MICROPY_GC_FREE_RUN_INDEX (1)
+#define MICROPY_GC_INCREMENTAL_SWEEP (1)
 
 #if !(defined(MICROPY_GCREGS_SETJMP) || defined(__x86_64__) || defined(__i386__) || defined(__thumb2__) || defined(__thumb__) || defined(__arm__) || (defined(__riscv) && (__riscv_xlen == 64)))
 // Fall back to setjmp() implementation for discovery of GC pointers in registers.
@@ -126,6 +128,8 @@ typedef long mp_off_t;
 #define MICROPY_READER_VFS          (1)
 #define MICROPY_HELPER_LEXER_UNIX   (1)
 #define MICROPY_VFS_POSIX           (1)
+#define MICROPY_VFS_IMPORT_CACHE    (1)
+#define MICROPY_PERSISTENT_CODE_CACHE (1)
 #define MICROPY_READER_POSIX        (1)
 // CIRCUITPY-CHANGE: define no matter what
 #ifndef MICROPY_TRACKED_ALLOC
@@ -32,13 +32,17 @@ SRC_BITMAP := \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
 	shared-bindings/audiocore/__init__.c \
+	shared-bindings/audiocore/BufferedSample.c \
 	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/Resampler.c \
 	shared-bindings/audiocore/WaveFile.c \
 	shared-bindings/audiodelays/Echo.c \
 	shared-bindings/audiodelays/Chorus.c \
 	shared-bindings/audiodelays/PitchShift.c \
 	shared-bindings/audiodelays/MultiTapDelay.c \
 	shared-bindings/audiodelays/__init__.c \
+	shared-bindings/audioeffects/Chain.c \
+	shared-bindings/audioeffects/__init__.c \
 	shared-bindings/audiofilters/Distortion.c \
 	shared-bindings/audiofilters/Filter.c \
 	shared-bindings/audiofilters/Phaser.c \
@@ -68,6 +72,7 @@ SRC_BITMAP := \
 	shared-bindings/synthio/LFO.c \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/BandlimitedWaveform.c \
 	shared-bindings/synthio/Synthesizer.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
@@ -80,13 +85,17 @@ SRC_BITMAP := \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
+	shared-module/audiocore/BufferedSample.c \
 	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/Resampler.c \
 	shared-module/audiocore/WaveFile.c \
 	shared-module/audiodelays/Echo.c \
 	shared-module/audiodelays/Chorus.c \
 	shared-module/audiodelays/PitchShift.c \
 	shared-module/audiodelays/MultiTapDelay.c \
 	shared-module/audiodelays/__init__.c \
+	shared-module/audioeffects/Chain.c \
+	shared-module/audioeffects/__init__.c \
 	shared-module/audiofilters/Distortion.c \
 	shared-module/audiofilters/Filter.c \
 	shared-module/audiofilters/Phaser.c \
@@ -115,6 +124,7 @@ SRC_BITMAP := \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
+	shared-module/synthio/BandlimitedWaveform.c \
 	shared-module/synthio/Synthesizer.c \
 	shared-bindings/vectorio/Circle.c \
 	shared-module/vectorio/Circle.c \
@@ -150,9 +160,15 @@ $(BUILD)/lib/mp3/src/buffers.o: CFLAGS += -include "shared-module/audiomp3/__ini
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE=1 \
+	-DCIRCUITPY_AUDIOCORE_RENDER=1 \
+	-DCIRCUITPY_AUDIOCORE_RESAMPLER=1 \
+	-DCIRCUITPY_AUDIOCORE_STATS=1 \
+	-DCIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING=1 \
 	-DCIRCUITPY_AUDIOEFFECTS=1 \
 	-DCIRCUITPY_AUDIODELAYS=1 \
 	-DCIRCUITPY_AUDIOFILTERS=1 \
+	-DCIRCUITPY_AUDIOFREEVERB=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOMP3=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
@@ -77,7 +77,9 @@
 #define MICROPY_MEM_STATS              (1)
 
 // Enable a small performance boost for the VM.
+#ifndef MICROPY_OPT_COMPUTED_GOTO
 #define MICROPY_OPT_COMPUTED_GOTO      (1)
+#endif
 
 // Return number of collected objects from gc.collect().
 #define MICROPY_PY_GC_COLLECT_RETVAL   (1)
@@ -0,0 +1,19 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+// This config is used to measure the MICROPY_OPT_* speed options. The options
+// are set from mpconfigvariant.mk so that tests/run-perfbench-opts.py can build
+// each combination of them.
+
+// Set base feature level.
+#define MICROPY_CONFIG_ROM_LEVEL (MICROPY_CONFIG_ROM_LEVEL_EXTRA_FEATURES)
+
+// Enable extra Unix features.
+#include "../mpconfigvariant_common.h"
+
+// CircuitPython uses shared-bindings struct
+#define MICROPY_PY_STRUCT              (0)
+#define MICROPY_PY_MICROPYTHON_RINGIO  (0)
@@ -0,0 +1,73 @@
+# Build for measuring the MICROPY_OPT_* speed options. Each option can be set on
+# the command line, for example:
+#   make VARIANT=perf BUILD=build-perf-nogoto OPT_COMPUTED_GOTO=0
+# tests/run-perfbench-opts.py builds and benchmarks every combination.
+
+OPT_COMPUTED_GOTO ?= 1
+OPT_INSTANCE_SHAPES ?= 1
+OPT_LOAD_ATTR_FAST_PATH ?= 1
+OPT_MAP_LOOKUP_CACHE ?= 1
+OPT_SITE_LOOKUP_CACHE ?= 1
+
+CFLAGS += \
+	-DMICROPY_OPT_COMPUTED_GOTO=$(OPT_COMPUTED_GOTO) \
+	-DMICROPY_OPT_INSTANCE_SHAPES=$(OPT_INSTANCE_SHAPES) \
+	-DMICROPY_OPT_LOAD_ATTR_FAST_PATH=$(OPT_LOAD_ATTR_FAST_PATH) \
+	-DMICROPY_OPT_MAP_LOOKUP_CACHE=$(OPT_MAP_LOOKUP_CACHE) \
+	-DMICROPY_OPT_SITE_LOOKUP_CACHE=$(OPT_SITE_LOOKUP_CACHE)
+
+# The modules used by the audio, displayio and synthio benchmarks in tests/perf_bench.
+SRC_C += \
+	shared/runtime/context_manager_helpers.c \
+	displayio_min.c \
+	shared-bindings/audiocore/__init__.c \
+	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/WaveFile.c \
+	shared-bindings/audiomixer/__init__.c \
+	shared-bindings/audiomixer/Mixer.c \
+	shared-bindings/audiomixer/MixerVoice.c \
+	shared-bindings/bitmaptools/__init__.c \
+	shared-bindings/displayio/Bitmap.c \
+	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Palette.c \
+	shared-bindings/synthio/__init__.c \
+	shared-bindings/synthio/BandlimitedWaveform.c \
+	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/LFO.c \
+	shared-bindings/synthio/Math.c \
+	shared-bindings/synthio/MidiTrack.c \
+	shared-bindings/synthio/Note.c \
+	shared-bindings/synthio/Synthesizer.c \
+	shared-bindings/util.c \
+	shared-module/audiocore/__init__.c \
+	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/WaveFile.c \
+	shared-module/audiomixer/__init__.c \
+	shared-module/audiomixer/Mixer.c \
+	shared-module/audiomixer/MixerVoice.c \
+	shared-module/bitmaptools/__init__.c \
+	shared-module/displayio/area.c \
+	shared-module/displayio/Bitmap.c \
+	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/Palette.c \
+	shared-module/synthio/__init__.c \
+	shared-module/synthio/BandlimitedWaveform.c \
+	shared-module/synthio/Biquad.c \
+	shared-module/synthio/LFO.c \
+	shared-module/synthio/Math.c \
+	shared-module/synthio/MidiTrack.c \
+	shared-module/synthio/Note.c \
+	shared-module/synthio/Synthesizer.c \
+
+CFLAGS += \
+	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
+	-DCIRCUITPY_AUDIOCORE_RENDER=1 \
+	-DCIRCUITPY_AUDIOMIXER=1 \
+	-DCIRCUITPY_BITMAPTOOLS=1 \
+	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
+	-DCIRCUITPY_SYNTHIO=1 \
+	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14
+
+# synthio/Math.c trips -Wfloat-conversion with double precision floats when optimizing for size.
+$(BUILD)/shared-module/synthio/Math.o: CFLAGS += -Wno-float-conversion
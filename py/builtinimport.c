@@ -198,6 +198,241 @@ static void do_execute_proto_fun(const mp_module_context_t *context, mp_proto_fu
 }
 #endif
 
+#if MICROPY_PERSISTENT_CODE_CACHE
+
+#if !(MICROPY_VFS && MICROPY_HAS_FILE_READER && MICROPY_PERSISTENT_CODE_LOAD)
+#error "MICROPY_PERSISTENT_CODE_CACHE requires MICROPY_VFS and MICROPY_PERSISTENT_CODE_LOAD"
+#endif
+
+#include "extmod/vfs.h"
+#include "py/stream.h"
+
+// Code compiled for a .py file is cached in MICROPY_PERSISTENT_CODE_CACHE_DIR,
+// in a file named after a hash of the absolute path of the source. The file is a
+// header that identifies the source, followed by the .mpy data. The header is the
+// path and a null, then the size, modification time and a hash of the contents of
+// the source as 32 bit little endian values, and the optimisation level the code
+// was compiled with. The size and time alone aren't enough: FAT times are only
+// good to 2 seconds, and boards without a clock give every file the same time.
+
+// 32-bit FNV-1a hash
+#define CACHE_HASH_INIT (2166136261u)
+static inline uint32_t cache_hash_byte(uint32_t hash, byte b) {
+    return (hash ^ b) * 16777619u;
+}
+
+// Hash the contents of the source. This reads it, but that is much quicker than
+// compiling it.
+static uint32_t cache_hash_source(qstr file_qstr) {
+    mp_reader_t reader;
+    mp_reader_new_file(&reader, file_qstr);
+    // Close the reader if reading raises
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader.close, reader.data);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+    uint32_t hash = CACHE_HASH_INIT;
+    for (mp_uint_t b; (b = reader.readbyte(reader.data)) != MP_READER_EOF;) {
+        hash = cache_hash_byte(hash, b);
+    }
+    nlr_pop_jump_callback(true);
+    return hash;
+}
+
+// The cache is skipped if the filesystem fails or a cache file is corrupt, which
+// raise OSError and ValueError. Anything else, such as MemoryError or
+// KeyboardInterrupt, is raised again.
+static void cache_check_error(nlr_buf_t *nlr) {
+    mp_obj_t type = MP_OBJ_FROM_PTR(mp_obj_get_type(MP_OBJ_FROM_PTR(nlr->ret_val)));
+    if (!mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_OSError))
+        && !mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_ValueError))) {
+        nlr_jump(nlr->ret_val);
+    }
+}
+
+static void cache_add_uint32(vstr_t *vstr, uint32_t value) {
+    for (int i = 0; i < 32; i += 8) {
+        vstr_add_byte(vstr, value >> i);
+    }
+}
+
+// Make the cache header and the cache file path for a source file. Returns false
+// if the source can't be stat'ed or read.
+static bool cache_make_key(qstr file_qstr, vstr_t *header, vstr_t *cache_path) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        cache_check_error(&nlr);
+        return false;
+    }
+    const char *file_str = qstr_str(file_qstr);
+    if (file_str[0] != PATH_SEP_CHAR[0]) {
+        vstr_add_str(header, mp_obj_str_get_str(mp_vfs_getcwd()));
+        if (header->len == 0 || header->buf[header->len - 1] != PATH_SEP_CHAR[0]) {
+            vstr_add_char(header, PATH_SEP_CHAR[0]);
+        }
+    }
+    vstr_add_str(header, file_str);
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(mp_vfs_stat(MP_OBJ_NEW_QSTR(file_qstr)), 10, &items);
+    uint32_t size = mp_obj_get_int_truncated(items[6]);
+    uint32_t mtime = mp_obj_get_int_truncated(items[8]);
+    uint32_t content_hash = cache_hash_source(file_qstr);
+    nlr_pop();
+
+    uint32_t hash = CACHE_HASH_INIT;
+    for (size_t i = 0; i < header->len; i++) {
+        hash = cache_hash_byte(hash, header->buf[i]);
+    }
+    vstr_printf(cache_path, MICROPY_PERSISTENT_CODE_CACHE_DIR PATH_SEP_CHAR "%08x.mpy", (uint)hash);
+
+    vstr_add_byte(header, 0);
+    cache_add_uint32(header, size);
+    cache_add_uint32(header, mtime);
+    cache_add_uint32(header, content_hash);
+    vstr_add_byte(header, MP_STATE_VM(mp_optimise_value));
+    return true;
+}
+
+// Load the cached code, if it was compiled from the source described by header.
+static bool cache_load(const vstr_t *header, vstr_t *cache_path, mp_compiled_module_t *cm) {
+    if (mp_import_stat(vstr_null_terminated_str(cache_path)) != MP_IMPORT_STAT_FILE) {
+        return false;
+    }
+    mp_reader_t reader;
+    bool volatile reader_open = false;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_new_file(&reader, qstr_from_strn(cache_path->buf, cache_path->len));
+        reader_open = true;
+        bool match = true;
+        for (size_t i = 0; i < header->len && match; i++) {
+            match = reader.readbyte(reader.data) == (byte)header->buf[i];
+        }
+        // mp_raw_code_load closes the reader, even if it raises
+        reader_open = false;
+        if (match) {
+            mp_raw_code_load(&reader, cm);
+        } else {
+            reader.close(reader.data);
+        }
+        nlr_pop();
+        return match;
+    }
+    if (reader_open) {
+        reader.close(reader.data);
+    }
+    // The cache file is unreadable or corrupt, so compile the source again
+    cache_check_error(&nlr);
+    return false;
+}
+
+static void cache_print_strn(void *env, const char *str, size_t len) {
+    int errcode;
+    if (mp_stream_rw(MP_OBJ_FROM_PTR(env), (void *)str, len, &errcode, MP_STREAM_RW_WRITE) != len) {
+        mp_raise_OSError(errcode != 0 ? errcode : MP_ENOSPC);
+    }
+}
+
+// Write compiled code to the cache. If that fails, for example because the
+// filesystem is read-only, the code is just not cached. The file is written
+// under a temporary name and then renamed, because the loader can't tell that
+// a file was cut short.
+static void cache_save(const vstr_t *header, const vstr_t *cache_path, mp_compiled_module_t *cm) {
+    mp_obj_t path = mp_obj_new_str(cache_path->buf, cache_path->len);
+    vstr_t temp;
+    vstr_init(&temp, cache_path->len);
+    vstr_add_strn(&temp, cache_path->buf, cache_path->len - 3);
+    vstr_add_str(&temp, "tmp");
+    mp_obj_t temp_path = mp_obj_new_str_from_vstr(&temp);
+    mp_obj_t volatile file = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = { temp_path, MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+        file = mp_vfs_open(2, args, (mp_map_t *)&mp_const_empty_map);
+        mp_print_t print = { MP_OBJ_TO_PTR(file), cache_print_strn };
+        print.print_strn(print.data, header->buf, header->len);
+        mp_raw_code_save(cm, &print);
+        mp_stream_close(file);
+        file = MP_OBJ_NULL;
+        mp_vfs_rename(temp_path, path);
+        nlr_pop();
+        return;
+    }
+    // Don't leave a partly written file behind
+    nlr_buf_t cleanup_nlr;
+    if (nlr_push(&cleanup_nlr) == 0) {
+        if (file != MP_OBJ_NULL) {
+            mp_stream_close(file);
+        }
+        mp_vfs_remove(temp_path);
+        nlr_pop();
+    } else {
+        cache_check_error(&cleanup_nlr);
+    }
+    cache_check_error(&nlr);
+}
+
+#if MICROPY_VFS_IMPORT_CACHE
+// Whether the cache directory existed, as of a generation of the import cache.
+// Most filesystems don't have one, and without this every import of a .py file
+// would pay for a failed stat of it.
+static bool cache_dir_known;
+static bool cache_dir_known_exists;
+static uint32_t cache_dir_generation;
+#endif
+
+// Nothing is cached unless the cache directory exists. It is stat'ed directly,
+// rather than with mp_import_stat, so that it can be a mount point.
+static bool cache_dir_exists(void) {
+    #if MICROPY_VFS_IMPORT_CACHE
+    // Take the generation first, so a change made during the stat is seen next time
+    uint32_t generation = mp_vfs_import_cache_generation();
+    if (cache_dir_known && cache_dir_generation == generation) {
+        return cache_dir_known_exists;
+    }
+    #endif
+    bool is_dir = false;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(mp_vfs_stat(MP_OBJ_NEW_QSTR(qstr_from_str(MICROPY_PERSISTENT_CODE_CACHE_DIR))), 10, &items);
+        is_dir = mp_obj_get_int(items[0]) & MP_S_IFDIR;
+        nlr_pop();
+    } else {
+        cache_check_error(&nlr);
+    }
+    #if MICROPY_VFS_IMPORT_CACHE
+    cache_dir_known = true;
+    cache_dir_known_exists = is_dir;
+    cache_dir_generation = generation;
+    #endif
+    return is_dir;
+}
+
+static void do_load_cached(mp_module_context_t *context, qstr file_qstr) {
+    vstr_t header;
+    vstr_t cache_path;
+    vstr_init(&header, 64);
+    vstr_init(&cache_path, sizeof(MICROPY_PERSISTENT_CODE_CACHE_DIR) + 14);
+    bool have_key = cache_make_key(file_qstr, &header, &cache_path);
+
+    mp_compiled_module_t cm;
+    cm.context = context;
+    if (!have_key || !cache_load(&header, &cache_path, &cm)) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, file_qstr, false, &cm);
+        // Native code has to be linked when it is loaded, so isn't cached
+        if (have_key && !cm.has_native) {
+            cache_save(&header, &cache_path, &cm);
+        }
+    }
+    vstr_clear(&header);
+    vstr_clear(&cache_path);
+
+    do_execute_proto_fun(context, cm.rc, file_qstr);
+}
+
+#endif // MICROPY_PERSISTENT_CODE_CACHE
+
 static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -257,6 +492,12 @@ static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        #if MICROPY_PERSISTENT_CODE_CACHE
+        if (cache_dir_exists()) {
+            do_load_cached(module_obj, file_qstr);
+            return;
+        }
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -134,6 +134,9 @@ endif
 ifeq ($(CIRCUITPY_AUDIODELAYS),1)
 SRC_PATTERNS += audiodelays/%
 endif
+ifeq ($(CIRCUITPY_AUDIOEFFECTS),1)
+SRC_PATTERNS += audioeffects/%
+endif
 ifeq ($(CIRCUITPY_AUDIOFILTERS),1)
 SRC_PATTERNS += audiofilters/%
 endif
@@ -683,7 +686,9 @@ SRC_SHARED_MODULE_ALL = \
 	aesio/__init__.c \
 	aesio/aes.c \
 	atexit/__init__.c \
+	audiocore/BufferedSample.c \
 	audiocore/RawSample.c \
+	audiocore/Resampler.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
 	audiodelays/Echo.c \
@@ -691,6 +696,8 @@ SRC_SHARED_MODULE_ALL = \
 	audiodelays/PitchShift.c \
 	audiodelays/MultiTapDelay.c \
 	audiodelays/__init__.c \
+	audioeffects/Chain.c \
+	audioeffects/__init__.c \
 	audiofilters/Distortion.c \
 	audiofilters/Filter.c \
 	audiofilters/Phaser.c \
@@ -796,6 +803,7 @@ SRC_SHARED_MODULE_ALL = \
 	struct/__init__.c \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
+	synthio/BandlimitedWaveform.c \
 	synthio/Biquad.c \
 	synthio/LFO.c \
 	synthio/Math.c \
@@ -68,6 +68,8 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ENABLE_DOC_STRING        (0)
 #define MICROPY_ENABLE_FINALISER         (1)
 #define MICROPY_ENABLE_SELECTIVE_COLLECT (1)
+#define MICROPY_GC_FREE_RUN_INDEX        (1)
+#define MICROPY_GC_INCREMENTAL_SWEEP     (CIRCUITPY_GC_INCREMENTAL_SWEEP)
 #define MICROPY_ENABLE_GC                (1)
 #define MICROPY_ENABLE_PYSTACK           (1)
 #define MICROPY_TRACKED_ALLOC            (CIRCUITPY_SSL_MBEDTLS)
@@ -91,11 +93,14 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
+#define MICROPY_OPT_INSTANCE_SHAPES   (CIRCUITPY_OPT_INSTANCE_SHAPES)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_SITE_LOOKUP_CACHE (CIRCUITPY_OPT_SITE_LOOKUP_CACHE)
 #define MICROPY_OPT_MPZ_BITWISE          (0)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PERSISTENT_CODE_CACHE    (CIRCUITPY_PERSISTENT_CODE_CACHE)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
@@ -183,6 +188,10 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_VFS                 (1)
 #define MICROPY_VFS_FAT             (MICROPY_VFS)
 #define MICROPY_READER_VFS          (MICROPY_VFS)
+#define MICROPY_VFS_IMPORT_CACHE    (CIRCUITPY_IMPORT_CACHE)
+#define MICROPY_VFS_ROM             (CIRCUITPY_VFS_ROM)
+// ROM images are mounted with storage.mount(), not found through vfs.rom_ioctl().
+#define MICROPY_VFS_ROM_IOCTL       (0)
 
 // type definitions for the specific machine
 
@@ -399,6 +408,16 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// Maximum number of areas sent per refresh. Dirty areas are merged to fit.
+#ifndef CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT
+#define CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT (8)
+#endif
+
+// Bus overhead of sending an area, in pixels. Dirty areas are merged when the extra pixels cost less.
+#ifndef CIRCUITPY_DISPLAY_REFRESH_AREA_COST
+#define CIRCUITPY_DISPLAY_REFRESH_AREA_COST (64)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
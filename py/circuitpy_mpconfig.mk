@@ -147,6 +147,25 @@ CFLAGS += -DCIRCUITPY_AUDIOCORE=$(CIRCUITPY_AUDIOCORE)
 CIRCUITPY_AUDIOMIXER ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_AUDIOMIXER=$(CIRCUITPY_AUDIOMIXER)
 
+CIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
+CFLAGS += -DCIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE=$(CIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE)
+
+CIRCUITPY_AUDIOCORE_RESAMPLER ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
+CFLAGS += -DCIRCUITPY_AUDIOCORE_RESAMPLER=$(CIRCUITPY_AUDIOCORE_RESAMPLER)
+
+CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
+CFLAGS += -DCIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING=$(CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING)
+
+# Time every get_buffer call and count output underruns, for audiocore.stats().
+# Only on full builds, because it adds two tick reads to every get_buffer,
+# including the ones made from DMA interrupts.
+CIRCUITPY_AUDIOCORE_STATS ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
+CFLAGS += -DCIRCUITPY_AUDIOCORE_STATS=$(CIRCUITPY_AUDIOCORE_STATS)
+
+# audiocore.render(), to play samples into buffers and files
+CIRCUITPY_AUDIOCORE_RENDER ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
+CFLAGS += -DCIRCUITPY_AUDIOCORE_RENDER=$(CIRCUITPY_AUDIOCORE_RENDER)
+
 ifndef CIRCUITPY_AUDIOCORE_DEBUG
 CIRCUITPY_AUDIOCORE_DEBUG ?= 0
 endif
@@ -156,6 +175,7 @@ CIRCUITPY_AUDIOMP3 ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_A
 CFLAGS += -DCIRCUITPY_AUDIOMP3=$(CIRCUITPY_AUDIOMP3)
 
 CIRCUITPY_AUDIOEFFECTS ?= 0
+CFLAGS += -DCIRCUITPY_AUDIOEFFECTS=$(CIRCUITPY_AUDIOEFFECTS)
 CIRCUITPY_AUDIODELAYS ?= $(CIRCUITPY_AUDIOEFFECTS)
 CFLAGS += -DCIRCUITPY_AUDIODELAYS=$(CIRCUITPY_AUDIODELAYS)
 CIRCUITPY_AUDIOFILTERS ?= $(CIRCUITPY_AUDIOEFFECTS)
@@ -330,6 +350,18 @@ CFLAGS += -DCIRCUITPY_FREQUENCYIO=$(CIRCUITPY_FREQUENCYIO)
 CIRCUITPY_FUTURE ?= 1
 CFLAGS += -DCIRCUITPY_FUTURE=$(CIRCUITPY_FUTURE)
 
+# Sweep the heap a slice at a time after a collection, from allocations and
+# background tasks, so audio and display output isn't starved by a long sweep.
+CIRCUITPY_GC_INCREMENTAL_SWEEP ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_GC_INCREMENTAL_SWEEP=$(CIRCUITPY_GC_INCREMENTAL_SWEEP)
+
+# Longest time, in microseconds, that a background task spends sweeping, and
+# the number of blocks it sweeps between checks of the time.
+CIRCUITPY_GC_SWEEP_SLICE_US ?= 250
+CFLAGS += -DCIRCUITPY_GC_SWEEP_SLICE_US=$(CIRCUITPY_GC_SWEEP_SLICE_US)
+CIRCUITPY_GC_SWEEP_STEP_BLOCKS ?= 128
+CFLAGS += -DCIRCUITPY_GC_SWEEP_STEP_BLOCKS=$(CIRCUITPY_GC_SWEEP_STEP_BLOCKS)
+
 CIRCUITPY_GETPASS ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_GETPASS=$(CIRCUITPY_GETPASS)
 
@@ -358,6 +390,10 @@ CFLAGS += -DCIRCUITPY_I2CIOEXPANDER=$(CIRCUITPY_I2CIOEXPANDER)
 CIRCUITPY_IMAGECAPTURE ?= 0
 CFLAGS += -DCIRCUITPY_IMAGECAPTURE=$(CIRCUITPY_IMAGECAPTURE)
 
+# Index the directories that imports look in, so missing files aren't stat'ed
+CIRCUITPY_IMPORT_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_IMPORT_CACHE=$(CIRCUITPY_IMPORT_CACHE)
+
 # io - needed by JSON support
 CIRCUITPY_IO ?= $(CIRCUITPY_JSON)
 CFLAGS += -DCIRCUITPY_IO=$(CIRCUITPY_IO)
@@ -429,15 +465,27 @@ CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 CIRCUITPY_ONEWIREIO ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 
+CIRCUITPY_OPT_INSTANCE_SHAPES ?= 0
+CFLAGS += -DCIRCUITPY_OPT_INSTANCE_SHAPES=$(CIRCUITPY_OPT_INSTANCE_SHAPES)
+
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_SITE_LOOKUP_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_OPT_SITE_LOOKUP_CACHE=$(CIRCUITPY_OPT_SITE_LOOKUP_CACHE)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
+# Cache the code compiled for .py imports in /.mpycache, when that directory exists.
+# This turns on MICROPY_PERSISTENT_CODE_SAVE, which costs flash for the .mpy writer
+# and RAM for a length and child count in each raw code, so boards opt in.
+CIRCUITPY_PERSISTENT_CODE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_PERSISTENT_CODE_CACHE=$(CIRCUITPY_PERSISTENT_CODE_CACHE)
+
 CIRCUITPY_PEW ?= 0
 CFLAGS += -DCIRCUITPY_PEW=$(CIRCUITPY_PEW)
 
@@ -723,6 +771,11 @@ CIRCUITPY_ULAB_OPTIMIZE_SIZE ?= 0
 CIRCUITPY_VIDEOCORE ?= 0
 CFLAGS += -DCIRCUITPY_VIDEOCORE=$(CIRCUITPY_VIDEOCORE)
 
+# storage.VfsRom: memory mapped, read-only filesystem images. Modules imported
+# from them run in place, without copying their bytecode into RAM.
+CIRCUITPY_VFS_ROM ?= 0
+CFLAGS += -DCIRCUITPY_VFS_ROM=$(CIRCUITPY_VFS_ROM)
+
 CIRCUITPY_WARNINGS ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_WARNINGS=$(CIRCUITPY_WARNINGS)
 
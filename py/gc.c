@@ -86,6 +86,12 @@
 #define ATB_MASK_2 (0x30)
 #define ATB_MASK_3 (0xc0)
 
+// Whole ATB bytes with all four blocks free, or all four in the tail of a chain.
+// Large long-lived objects are mostly tail blocks, so the sweep skips these a
+// byte at a time.
+#define ATB_ALL_FREE (0x00)
+#define ATB_ALL_TAIL (0xaa)
+
 #define ATB_0_IS_FREE(a) (((a) & ATB_MASK_0) == 0)
 #define ATB_1_IS_FREE(a) (((a) & ATB_MASK_1) == 0)
 #define ATB_2_IS_FREE(a) (((a) & ATB_MASK_2) == 0)
@@ -135,6 +141,25 @@
 #define CTB_SET(area, block) do { area->gc_collect_table_start[(block) / BLOCKS_PER_CTB] |= (1 << ((block) & 7)); } while (0)
 #define CTB_CLEAR(area, block) do { area->gc_collect_table_start[(block) / BLOCKS_PER_CTB] &= (~(1 << ((block) & 7))); } while (0)
 
+#if MICROPY_GC_FREE_RUN_INDEX
+// FRI = free run index
+// one byte per run of ATB_PER_FRI alloc table bytes, holding an upper bound of
+// the longest run of free blocks within those blocks. Allocating only shortens
+// free runs so leaves it valid; freeing recomputes the entries it touches.
+
+#define ATB_PER_FRI (32)
+#define BLOCKS_PER_FRI (ATB_PER_FRI * BLOCKS_PER_ATB)
+#endif
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Until a block has been swept after a collection, a live head in it is still
+// marked and an unmarked head is garbage.
+#define BLOCK_IS_UNSWEPT(area, block) ((block) >= (area)->gc_sweep_block && (block) < (area)->gc_sweep_end_block)
+#define ATB_LIVE_HEAD_KIND(area, block) (BLOCK_IS_UNSWEPT(area, block) ? AT_MARK : AT_HEAD)
+#else
+#define ATB_LIVE_HEAD_KIND(area, block) (AT_HEAD)
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_MUTEX_INIT() mp_thread_recursive_mutex_init(&MP_STATE_MEM(gc_mutex))
 #define GC_ENTER() mp_thread_recursive_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
@@ -169,6 +194,12 @@ static void gc_mark_subtree(size_t block);
 static void gc_deal_with_stack_overflow(void);
 static void gc_sweep_run_finalisers(void);
 static void gc_sweep_free_blocks(void);
+#if MICROPY_GC_INCREMENTAL_SWEEP
+static bool gc_sweep_some(size_t n_blocks);
+#endif
+#if MICROPY_GC_FREE_RUN_INDEX
+static void gc_free_run_index_update(mp_state_mem_area_t *area, size_t first_block, size_t last_block);
+#endif
 
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
@@ -181,6 +212,14 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
 
     size_t total_byte_len = (byte *)end - (byte *)start;
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // Set aside the free run index first; it is at most one byte per BLOCKS_PER_FRI
+    // blocks, which is less than one bit per block so doesn't fit the sums below.
+    // The extra byte covers rounding up the FTB and CTB lengths.
+    size_t gc_free_run_index_byte_len = total_byte_len / (BLOCKS_PER_FRI * BYTES_PER_BLOCK) + 2;
+    total_byte_len -= gc_free_run_index_byte_len;
+    #endif
+
     // Calculate the denominator for the alloc table size calculation
     size_t bits_per_block = MP_BITS_PER_BYTE / BLOCKS_PER_ATB; // Start with bits for ATB
 
@@ -219,6 +258,11 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     next_table += gc_collect_table_byte_len;
     #endif
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    area->gc_free_run_index_start = next_table;
+    next_table += gc_free_run_index_byte_len;
+    #endif
+
     // Set pool pointers
     area->gc_pool_start = (byte *)end - gc_pool_block_len * BYTES_PER_BLOCK;
     area->gc_pool_end = end;
@@ -230,9 +274,24 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     size_t tables_size = next_table - area->gc_alloc_table_start;
     memset(area->gc_alloc_table_start, 0, tables_size);
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // The whole pool is free.
+    memset(area->gc_free_run_index_start, BLOCKS_PER_FRI, gc_free_run_index_byte_len);
+    #endif
+
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    area->gc_fit_atb_index = 0;
+    area->gc_fit_blocks = 1;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    area->gc_sweep_block = 0;
+    area->gc_sweep_end_block = 0;
+    #endif
+
     #if MICROPY_GC_SPLIT_HEAP
     area->next = NULL;
     #endif
@@ -254,6 +313,10 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
         gc_collect_table_byte_len,
         gc_collect_table_byte_len * BLOCKS_PER_CTB);
     #endif
+    #if MICROPY_GC_FREE_RUN_INDEX
+    DEBUG_printf("  free run index at %p, length " UINT_FMT " bytes\n",
+        area->gc_free_run_index_start, gc_free_run_index_byte_len);
+    #endif
     DEBUG_printf("  pool at %p, length " UINT_FMT " bytes, "
         UINT_FMT " blocks\n", area->gc_pool_start,
         gc_pool_block_len * BYTES_PER_BLOCK, gc_pool_block_len);
@@ -277,6 +340,10 @@ void gc_init(void *start, void *end) {
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_pending) = false;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
@@ -317,6 +384,7 @@ static size_t compute_heap_size(size_t total_blocks) {
     size_t atb_bytes = (total_blocks + BLOCKS_PER_ATB - 1) / BLOCKS_PER_ATB;
     size_t ftb_bytes = 0;
     size_t ctb_bytes = 0;
+    size_t fri_bytes = 0;
     #if MICROPY_ENABLE_FINALISER
     ftb_bytes = (total_blocks + BLOCKS_PER_FTB - 1) / BLOCKS_PER_FTB;
     #endif
@@ -324,6 +392,10 @@ static size_t compute_heap_size(size_t total_blocks) {
     ctb_bytes = (total_blocks + BLOCKS_PER_CTB - 1) / BLOCKS_PER_CTB;
     #endif
     size_t pool_bytes = total_blocks * BYTES_PER_BLOCK;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // gc_setup_area sizes the index from the whole area, tables included.
+    fri_bytes = (atb_bytes + ftb_bytes + ctb_bytes + pool_bytes) / (BLOCKS_PER_FRI * BYTES_PER_BLOCK) + 3;
+    #endif
 
     // Compute bytes needed to build a heap with total_blocks blocks.
     size_t total_heap =
@@ -332,6 +404,7 @@ static size_t compute_heap_size(size_t total_blocks) {
         + ALLOC_TABLE_GAP_BYTE
         + ftb_bytes
         + ctb_bytes
+        + fri_bytes
         + pool_bytes
         + BYTES_PER_BLOCK; // Extra block of bytes to account for end pointer alignment
 
@@ -488,6 +561,12 @@ static inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
 #endif
 #endif
 
+// Every collection marks the whole heap, including objects that have survived many collections.
+// Skipping those, in a nursery or a tenured region that isn't re-marked, is only safe if every store
+// of a young pointer into an old object is recorded. Those stores are plain C assignments all over
+// the tree, e.g. Group.insert and TileGrid.bitmap write straight into long-lived displayio objects.
+// Long-lived blocks are kept cheap to mark instead: leaf chains aren't walked by gc_mark_subtree
+// and runs of free or tail blocks are swept a byte at a time.
 void gc_collect_start(void) {
     gc_collect_start_common();
     #if MICROPY_GC_ALLOC_THRESHOLD
@@ -511,6 +590,10 @@ void gc_collect_start(void) {
 
 static void gc_collect_start_common(void) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Marking needs all heads unmarked, so finish off the last collection.
+    gc_sweep_some(SIZE_MAX);
+    #endif
     assert((MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG) == 0);
     MP_STATE_THREAD(gc_lock_depth) |= GC_COLLECT_FLAG;
     MP_STATE_MEM(gc_stack_overflow) = 0;
@@ -565,15 +648,6 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
         mp_state_mem_area_t *area = &MP_STATE_MEM(area);
         #endif
 
-        // work out number of consecutive blocks in the chain starting with this one
-        size_t n_blocks = 0;
-        do {
-            n_blocks += 1;
-        } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
-
-        // check that the consecutive blocks didn't overflow past the end of the area
-        assert(area->gc_pool_start + (block + n_blocks) * BYTES_PER_BLOCK <= area->gc_pool_end);
-
         // CIRCUITPY-CHANGE
         // check if this block should be collected
         #if MICROPY_ENABLE_SELECTIVE_COLLECT
@@ -584,6 +658,16 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 
         // Only scan the block's children if it's not a leaf
         if (should_scan) {
+            // work out number of consecutive blocks in the chain starting with this one
+            // (leaves are skipped before this, so large buffers don't walk their tails)
+            size_t n_blocks = 0;
+            do {
+                n_blocks += 1;
+            } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+
+            // check that the consecutive blocks didn't overflow past the end of the area
+            assert(area->gc_pool_start + (block + n_blocks) * BYTES_PER_BLOCK <= area->gc_pool_end);
+
             // check this block's children
             void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
             for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
@@ -640,6 +724,11 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 void gc_sweep_all(void) {
     gc_collect_start_common();
     gc_collect_end();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    GC_ENTER();
+    gc_sweep_some(SIZE_MAX);
+    GC_EXIT();
+    #endif
 }
 
 void gc_collect_end(void) {
@@ -719,12 +808,86 @@ static void gc_sweep_run_finalisers(void) {
     #endif // MICROPY_ENABLE_FINALISER
 }
 
+// Free unmarked heads and their tails in blocks block..end_block-1 of area, and
+// unmark the marked heads. block must be at the start of an object. Stops early
+// at the first object boundary at or after stop_block, returning where it stopped.
+// *last_used_block is raised to the highest block found still in use.
+static size_t gc_sweep_area(mp_state_mem_area_t *area, size_t block, size_t stop_block, size_t end_block, size_t *last_used_block) {
+    int free_tail = 0;
+
+    for (; block < end_block; block++) {
+        MICROPY_GC_HOOK_LOOP(block);
+        if (block >= stop_block && ATB_GET_KIND(area, block) != AT_TAIL) {
+            break;
+        }
+        if (block % BLOCKS_PER_ATB == 0 && block + BLOCKS_PER_ATB <= end_block) {
+            byte *a = &area->gc_alloc_table_start[block / BLOCKS_PER_ATB];
+            if (*a == ATB_ALL_FREE) {
+                block += BLOCKS_PER_ATB - 1;
+                continue;
+            }
+            if (*a == ATB_ALL_TAIL) {
+                if (free_tail) {
+                    *a = ATB_ALL_FREE;
+                    #if CLEAR_ON_SWEEP
+                    memset((void *)PTR_FROM_BLOCK(area, block), 0, BLOCKS_PER_ATB * BYTES_PER_BLOCK);
+                    #endif
+                } else {
+                    *last_used_block = MAX(*last_used_block, block + BLOCKS_PER_ATB - 1);
+                }
+                block += BLOCKS_PER_ATB - 1;
+                continue;
+            }
+        }
+        switch (ATB_GET_KIND(area, block)) {
+            case AT_HEAD:
+                free_tail = 1;
+                DEBUG_printf("gc_sweep_free_blocks(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
+                #if MICROPY_PY_GC_COLLECT_RETVAL
+                MP_STATE_MEM(gc_collected)++;
+                #endif
+                // fall through to free the head
+                MP_FALLTHROUGH
+
+            case AT_TAIL:
+                if (free_tail) {
+                    ATB_ANY_TO_FREE(area, block);
+                    #if CLEAR_ON_SWEEP
+                    memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
+                    #endif
+                } else {
+                    *last_used_block = MAX(*last_used_block, block);
+                }
+                break;
+
+            case AT_MARK:
+                ATB_MARK_TO_HEAD(area, block);
+                free_tail = 0;
+                *last_used_block = MAX(*last_used_block, block);
+                break;
+        }
+    }
+
+    return block;
+}
+
 // Free unmarked heads and their tails
 static void gc_sweep_free_blocks(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
-    int free_tail = 0;
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Leave the sweep to gc_sweep_some.
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        assert(area->gc_last_used_block <= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        area->gc_sweep_block = 0;
+        area->gc_sweep_end_block = area->gc_last_used_block + 1;
+        area->gc_sweep_last_used_block = 0;
+    }
+    MP_STATE_MEM(gc_sweep_pending) = true;
+    #else
+
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     mp_state_mem_area_t *prev_area = NULL;
     #endif
@@ -732,40 +895,17 @@ static void gc_sweep_free_blocks(void) {
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         size_t last_used_block = 0;
         assert(area->gc_last_used_block <= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        size_t end_block = area->gc_last_used_block + 1;
 
-        for (size_t block = 0; block <= area->gc_last_used_block; block++) {
-            MICROPY_GC_HOOK_LOOP(block);
-            switch (ATB_GET_KIND(area, block)) {
-                case AT_HEAD:
-                    free_tail = 1;
-                    DEBUG_printf("gc_sweep_free_blocks(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
-                    #if MICROPY_PY_GC_COLLECT_RETVAL
-                    MP_STATE_MEM(gc_collected)++;
-                    #endif
-                    // fall through to free the head
-                    MP_FALLTHROUGH
-
-                case AT_TAIL:
-                    if (free_tail) {
-                        ATB_ANY_TO_FREE(area, block);
-                        #if CLEAR_ON_SWEEP
-                        memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
-                        #endif
-                    } else {
-                        last_used_block = block;
-                    }
-                    break;
-
-                case AT_MARK:
-                    ATB_MARK_TO_HEAD(area, block);
-                    free_tail = 0;
-                    last_used_block = block;
-                    break;
-            }
-        }
+        gc_sweep_area(area, 0, end_block, end_block, &last_used_block);
 
         area->gc_last_used_block = last_used_block;
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        // Blocks past the last used one were free already, so are indexed correctly.
+        gc_free_run_index_update(area, 0, end_block - 1);
+        #endif
+
         #if MICROPY_GC_SPLIT_HEAP_AUTO
         // Free any empty area, aside from the first one
         if (last_used_block == 0 && prev_area != NULL) {
@@ -777,8 +917,115 @@ static void gc_sweep_free_blocks(void) {
         prev_area = area;
         #endif
     }
+    #endif // MICROPY_GC_INCREMENTAL_SWEEP
 }
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Sweep about n_blocks of the blocks left by gc_sweep_free_blocks, in heap
+// order. Must be called with the GC mutex held. Returns true if any are left.
+static bool gc_sweep_some(size_t n_blocks) {
+    if (!MP_STATE_MEM(gc_sweep_pending)) {
+        return false;
+    }
+
+    #if MICROPY_GC_SPLIT_HEAP_AUTO
+    mp_state_mem_area_t *prev_area = NULL;
+    #endif
+
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t block = area->gc_sweep_block;
+        size_t end_block = area->gc_sweep_end_block;
+        if (block < end_block) {
+            if (n_blocks == 0) {
+                return true;
+            }
+            size_t stop_block = end_block - block > n_blocks ? block + n_blocks : end_block;
+            stop_block = gc_sweep_area(area, block, stop_block, end_block, &area->gc_sweep_last_used_block);
+            area->gc_sweep_block = stop_block;
+            n_blocks -= MIN(n_blocks, stop_block - block);
+
+            #if MICROPY_GC_FREE_RUN_INDEX
+            gc_free_run_index_update(area, block, stop_block - 1);
+            #endif
+
+            // Blocks may have been freed before the next scan would start.
+            #if MICROPY_GC_SPLIT_HEAP
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+            #endif
+            if (block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+                area->gc_last_free_atb_index = block / BLOCKS_PER_ATB;
+            }
+
+            if (stop_block < end_block) {
+                return true;
+            }
+
+            // gc_alloc and gc_realloc raise gc_sweep_last_used_block while a sweep
+            // is pending, so it covers blocks allocated since the collection too.
+            area->gc_last_used_block = area->gc_sweep_last_used_block;
+
+            #if MICROPY_GC_SPLIT_HEAP_AUTO
+            // Free any empty area, aside from the first one
+            if (area->gc_last_used_block == 0 && prev_area != NULL) {
+                DEBUG_printf("gc_sweep_some free empty area %p\n", area);
+                NEXT_AREA(prev_area) = NEXT_AREA(area);
+                MP_PLAT_FREE_HEAP(area);
+                area = prev_area;
+            }
+            #endif
+        }
+        #if MICROPY_GC_SPLIT_HEAP_AUTO
+        prev_area = area;
+        #endif
+    }
+
+    MP_STATE_MEM(gc_sweep_pending) = false;
+    return false;
+}
+
+bool gc_sweep_step(size_t n_blocks) {
+    // The heap can't be swept during a collection, or changed while it's locked.
+    if (!MP_STATE_MEM(gc_sweep_pending) || MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return MP_STATE_MEM(gc_sweep_pending);
+    }
+    GC_ENTER();
+    bool pending = gc_sweep_some(n_blocks);
+    GC_EXIT();
+    return pending;
+}
+#endif
+
+#if MICROPY_GC_FREE_RUN_INDEX
+// Recompute the free run index entries covering first_block..last_block inclusive.
+static void gc_free_run_index_update(mp_state_mem_area_t *area, size_t first_block, size_t last_block) {
+    // The blocks may have been freed, so a fit may start there now
+    if (first_block / BLOCKS_PER_ATB < area->gc_fit_atb_index) {
+        area->gc_fit_atb_index = first_block / BLOCKS_PER_ATB;
+    }
+    for (size_t fri = first_block / BLOCKS_PER_FRI; fri <= last_block / BLOCKS_PER_FRI; fri++) {
+        size_t run = 0;
+        size_t max_run = 0;
+        size_t atb_end = MIN((fri + 1) * ATB_PER_FRI, area->gc_alloc_table_byte_len);
+        for (size_t i = fri * ATB_PER_FRI; i < atb_end; i++) {
+            byte a = area->gc_alloc_table_start[i];
+            if (a == ATB_ALL_FREE) {
+                run += BLOCKS_PER_ATB;
+                continue;
+            }
+            for (size_t j = 0; j < BLOCKS_PER_ATB; j++, a >>= 2) {
+                if (ATB_0_IS_FREE(a)) {
+                    run += 1;
+                } else {
+                    max_run = MAX(max_run, run);
+                    run = 0;
+                }
+            }
+        }
+        area->gc_free_run_index_start[fri] = MAX(max_run, run);
+    }
+}
+#endif
+
 // CIRCUITPY-CHANGE: add function
 void gc_collect_ptr(void *ptr) {
     void *ptrs[1] = { ptr };
@@ -803,6 +1050,9 @@ static void *MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_get_ptr)(void **ptrs, int i) {
 
 void gc_info(gc_info_t *info) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_some(SIZE_MAX);
+    #endif
     info->total = 0;
     info->used = 0;
     info->free = 0;
@@ -903,11 +1153,16 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     size_t end_block;
     size_t start_block;
     size_t n_free;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t skipped_free;
+    size_t fri_scan_start;
+    bool use_fit = true;
+    bool from_fit;
+    #endif
     int collected = !MP_STATE_MEM(gc_auto_collect_enabled);
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
     #endif
-
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
         GC_EXIT();
@@ -917,6 +1172,14 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     }
     #endif
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    size_t sweep_blocks = MICROPY_GC_SWEEP_SLICE_BLOCKS;
+
+    // Pay for the sweep left by the last collection a slice at a time. Right
+    // after a collection this frees the start of the heap for the scan below.
+    gc_sweep_some(sweep_blocks);
+    #endif
+
     for (;;) {
 
         #if MICROPY_GC_SPLIT_HEAP
@@ -925,6 +1188,12 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         area = &MP_STATE_MEM(area);
         #endif
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        // Nonzero once the scan passes over free blocks too few for n_blocks
+        skipped_free = 0;
+        from_fit = false;
+        #endif
+
         // CIRCUITPY-CHANGE
         if (area == 0) {
             reset_into_safe_mode(SAFE_MODE_GC_ALLOC_OUTSIDE_VM);
@@ -933,14 +1202,62 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
             n_free = 0;
-            for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
+            i = area->gc_last_free_atb_index;
+            #if MICROPY_GC_FREE_RUN_INDEX
+            fri_scan_start = SIZE_MAX;
+            // A run of n_blocks can't be before the fit index, so start there,
+            // passing over free blocks.
+            if (use_fit && n_blocks >= area->gc_fit_blocks && area->gc_fit_atb_index > i) {
+                i = area->gc_fit_atb_index;
+                skipped_free = 1;
+                from_fit = true;
+            }
+            #endif
+            for (; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
+                #if MICROPY_GC_FREE_RUN_INDEX
+                // Having scanned all of the previous indexed run without a fit, none
+                // of its free runs is n_blocks long, so tighten its bound to match.
+                if (i % ATB_PER_FRI == 0 && fri_scan_start + ATB_PER_FRI == i) {
+                    byte *fri = &area->gc_free_run_index_start[fri_scan_start / ATB_PER_FRI];
+                    if (*fri >= n_blocks) {
+                        *fri = n_blocks - 1;
+                    }
+                }
+                // At the start of each indexed run of blocks, skip it if the run
+                // being counted can't be extended through it to n_blocks and it has
+                // no long enough free run of its own. Only a free run in its last
+                // max_run blocks could still be the start of a fit, so resume there.
+                while (i % ATB_PER_FRI == 0 && i + ATB_PER_FRI <= area->gc_alloc_table_byte_len) {
+                    size_t max_run = area->gc_free_run_index_start[i / ATB_PER_FRI];
+                    size_t skip = (BLOCKS_PER_FRI - max_run) / BLOCKS_PER_ATB;
+                    if (skip == 0 || n_free + max_run >= n_blocks) {
+                        break;
+                    }
+                    i += skip;
+                    skipped_free |= max_run;
+                    n_free = 0;
+                }
+                if (i % ATB_PER_FRI == 0) {
+                    fri_scan_start = i;
+                }
+                if (i >= area->gc_alloc_table_byte_len) {
+                    break;
+                }
+                #endif
                 byte a = area->gc_alloc_table_start[i];
                 // *FORMAT-OFF*
+                #if MICROPY_GC_FREE_RUN_INDEX
+                if (ATB_0_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 0; goto found; } } else { skipped_free |= n_free; n_free = 0; }
+                if (ATB_1_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 1; goto found; } } else { skipped_free |= n_free; n_free = 0; }
+                if (ATB_2_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 2; goto found; } } else { skipped_free |= n_free; n_free = 0; }
+                if (ATB_3_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 3; goto found; } } else { skipped_free |= n_free; n_free = 0; }
+                #else
                 if (ATB_0_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 0; goto found; } } else { n_free = 0; }
                 if (ATB_1_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 1; goto found; } } else { n_free = 0; }
                 if (ATB_2_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 2; goto found; } } else { n_free = 0; }
                 if (ATB_3_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 3; goto found; } } else { n_free = 0; }
+                #endif
                 // *FORMAT-ON*
             }
 
@@ -954,6 +1271,24 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             #endif
         }
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        // A run that crosses the fit index may have been missed, so scan all
+        // of the heap once before sweeping or collecting.
+        if (from_fit) {
+            use_fit = false;
+            continue;
+        }
+        #endif
+
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        // Sweep more before collecting again, doubling the slice each time so
+        // a large unswept heap is only rescanned a few times.
+        if (gc_sweep_some(sweep_blocks)) {
+            sweep_blocks *= 2;
+            continue;
+        }
+        #endif
+
         GC_EXIT();
         // nothing found!
         if (collected) {
@@ -974,6 +1309,9 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         gc_collect();
         collected = 1;
         GC_ENTER();
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        gc_sweep_some(sweep_blocks);
+        #endif
     }
 
     // found, ending at block i inclusive
@@ -985,15 +1323,30 @@ found:
     // Set last free ATB index to block after last block we found, for start of
     // next scan.  To reduce fragmentation, we only do this if we were looking
     // for a single free block, which guarantees that there are no free blocks
-    // before this one.  Also, whenever we free or shink a block we must check
-    // if this index needs adjusting (see gc_realloc and gc_free).
+    // before this one.  With the free run index, we also do it if the scan found
+    // no free blocks before this run.  Also, whenever we free or shink a block
+    // we must check if this index needs adjusting (see gc_realloc and gc_free).
+    #if MICROPY_GC_FREE_RUN_INDEX
+    if (!skipped_free) {
+    #else
     if (n_free == 1) {
+    #endif
         #if MICROPY_GC_SPLIT_HEAP
         MP_STATE_MEM(gc_last_free_area) = area;
         #endif
         area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB;
     }
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // No run before this one was n_blocks long. Move the fit index past it if
+    // that doesn't exclude smaller allocations that could use the index now.
+    if ((i + 1) / BLOCKS_PER_ATB >= area->gc_fit_atb_index
+        && (n_blocks <= area->gc_fit_blocks || area->gc_fit_atb_index <= area->gc_last_free_atb_index)) {
+        area->gc_fit_atb_index = (i + 1) / BLOCKS_PER_ATB;
+        area->gc_fit_blocks = n_blocks;
+    }
+    #endif
+
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
     gc_log_change(start_block, end_block - start_block + 1);
@@ -1004,6 +1357,16 @@ found:
     // mark first block as used head
     ATB_FREE_TO_HEAD(area, start_block);
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (MP_STATE_MEM(gc_sweep_pending)) {
+        area->gc_sweep_last_used_block = MAX(area->gc_sweep_last_used_block, end_block);
+        // Allocate marked where the sweep has still to go, so it isn't freed.
+        if (BLOCK_IS_UNSWEPT(area, start_block)) {
+            ATB_HEAD_TO_MARK(area, start_block);
+        }
+    }
+    #endif
+
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
     for (size_t bl = start_block + 1; bl <= end_block; bl++) {
@@ -1111,7 +1474,7 @@ void gc_free(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD
+    assert(ATB_GET_KIND(area, block) == ATB_LIVE_HEAD_KIND(area, block)
         || (ATB_GET_KIND(area, block) == AT_MARK && (MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG)));
 
     #if MICROPY_ENABLE_FINALISER
@@ -1144,11 +1507,18 @@ void gc_free(void *ptr) {
     #endif
 
     // free head and all of its tail blocks
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t first_block = block;
+    #endif
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    gc_free_run_index_update(area, first_block, block - 1);
+    #endif
+
     GC_EXIT();
 
     #if EXTENSIVE_HEAP_PROFILING
@@ -1172,7 +1542,7 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        if (ATB_GET_KIND(area, block) == ATB_LIVE_HEAD_KIND(area, block)) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1219,7 +1589,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    assert(ATB_GET_KIND(area, block) == ATB_LIVE_HEAD_KIND(area, block));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1263,6 +1633,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             ATB_ANY_TO_FREE(area, bl);
         }
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_run_index_update(area, block + new_blocks, block + n_blocks - 1);
+        #endif
+
         #if MICROPY_GC_SPLIT_HEAP
         if (MP_STATE_MEM(gc_last_free_area) != area) {
             // See comment in gc_free.
@@ -1303,6 +1677,11 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         }
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (MP_STATE_MEM(gc_sweep_pending)) {
+            area->gc_sweep_last_used_block = MAX(area->gc_sweep_last_used_block, end_block);
+        }
+        #endif
 
         GC_EXIT();
 
@@ -1381,6 +1760,9 @@ void gc_dump_info(const mp_print_t *print) {
 
 void gc_dump_alloc_table(const mp_print_t *print) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_some(SIZE_MAX);
+    #endif
     static const size_t DUMP_BYTES_PER_LINE = 64;
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         #if !EXTENSIVE_HEAP_PROFILING
@@ -71,6 +71,12 @@ bool gc_alloc_possible(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Sweep about n_blocks more of the heap left unswept by the last collection.
+// Returns true if some of it is still unswept.
+bool gc_sweep_step(size_t n_blocks);
+#endif
+
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
     // CIRCUITPY-CHANGE
@@ -34,6 +34,10 @@
 static mp_obj_t py_gc_collect(void) {
     gc_collect();
     #if MICROPY_PY_GC_COLLECT_RETVAL
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // The count is only complete once the sweep is.
+    gc_sweep_step(SIZE_MAX);
+    #endif
     return MP_OBJ_NEW_SMALL_INT(MP_STATE_MEM(gc_collected));
     #else
     return mp_const_none;
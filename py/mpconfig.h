@@ -342,11 +342,25 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// Whether imports of .py files save the code they compile, as .mpy data, in
+// MICROPY_PERSISTENT_CODE_CACHE_DIR and load it from there while the source's
+// path, size, modification time and contents are unchanged. Nothing is cached
+// unless that directory exists. Requires MICROPY_VFS and
+// MICROPY_PERSISTENT_CODE_LOAD. With MICROPY_VFS_IMPORT_CACHE, whether the
+// directory exists is only checked again after a filesystem changes.
+#ifndef MICROPY_PERSISTENT_CODE_CACHE
+#define MICROPY_PERSISTENT_CODE_CACHE (0)
+#endif
+
+#ifndef MICROPY_PERSISTENT_CODE_CACHE_DIR
+#define MICROPY_PERSISTENT_CODE_CACHE_DIR "/.mpycache"
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
-// objects which is also required for sys.settrace.
+// objects which is also required for sys.settrace and the code cache.
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
-#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE)
+#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE || MICROPY_PERSISTENT_CODE_CACHE)
 #endif
 
 // Whether to support saving persistent code to a file via mp_raw_code_save_file
@@ -601,6 +615,38 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// Use extra RAM to remember, for each LOAD_ATTR, LOAD_METHOD and LOAD_GLOBAL
+// bytecode site, the map slot its name was last found in. Unlike the map lookup
+// cache above, entries are keyed by the site rather than by the name, so sites
+// looking up the same name on different classes don't evict each other.
+#ifndef MICROPY_OPT_SITE_LOOKUP_CACHE
+#define MICROPY_OPT_SITE_LOOKUP_CACHE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
+#endif
+
+// How many bytecode sites the site lookup cache holds. Each entry uses three words.
+#ifndef MICROPY_OPT_SITE_LOOKUP_CACHE_SIZE
+#define MICROPY_OPT_SITE_LOOKUP_CACHE_SIZE (64)
+#endif
+
+// Whether instances of classes keep their attributes in an array of slots, laid
+// out by a "shape" shared by the instances that assigned the same attributes in
+// the same order, instead of in a map each. This saves a heap block per instance,
+// and an attribute is found by comparing names instead of by hashing. An instance
+// whose attributes diverge, eg by deleting one, falls back to a map. Requires
+// MICROPY_ENABLE_GC.
+#ifndef MICROPY_OPT_INSTANCE_SHAPES
+#define MICROPY_OPT_INSTANCE_SHAPES (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
+#endif
+
+// The most attributes an instance keeps in slots, and the most shapes a class has.
+// Each shape uses a heap block of about three words plus half a word per name.
+#ifndef MICROPY_OPT_INSTANCE_SHAPES_MAX_SLOTS
+#define MICROPY_OPT_INSTANCE_SHAPES_MAX_SLOTS (16)
+#endif
+#ifndef MICROPY_OPT_INSTANCE_SHAPES_MAX_SHAPES
+#define MICROPY_OPT_INSTANCE_SHAPES_MAX_SHAPES (32)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -677,6 +723,25 @@
 #define MICROPY_ENABLE_GC (0)
 #endif
 
+// Whether to keep an index of the longest free run of blocks in each part of the
+// heap, so gc_alloc can skip parts that can't satisfy an allocation instead of
+// scanning their allocation table. Uses one byte of RAM per 128 blocks.
+#ifndef MICROPY_GC_FREE_RUN_INDEX
+#define MICROPY_GC_FREE_RUN_INDEX (0)
+#endif
+
+// Whether gc_collect_end leaves the heap to be swept a slice at a time, by later
+// allocations and calls to gc_sweep_step, instead of sweeping it all at once.
+// This bounds the pause after the mark phase on large heaps.
+#ifndef MICROPY_GC_INCREMENTAL_SWEEP
+#define MICROPY_GC_INCREMENTAL_SWEEP (0)
+#endif
+
+// Number of blocks swept per slice of an incremental sweep.
+#ifndef MICROPY_GC_SWEEP_SLICE_BLOCKS
+#define MICROPY_GC_SWEEP_SLICE_BLOCKS (1024)
+#endif
+
 // Whether the garbage-collected heap can be split over multiple memory areas.
 #ifndef MICROPY_GC_SPLIT_HEAP
 #define MICROPY_GC_SPLIT_HEAP (0)
@@ -1050,6 +1115,21 @@ typedef double mp_float_t;
 #define MICROPY_VFS (0)
 #endif
 
+// Whether imports keep an index of the names in each directory they look in, so
+// that stats of files that don't exist are answered without the filesystem.
+// Indexes are dropped when a filesystem changes, and ports must call
+// mp_vfs_import_cache_invalidate() when one is changed from outside the VM.
+// VfsPosix directories are never indexed, since other processes change them.
+#ifndef MICROPY_VFS_IMPORT_CACHE
+#define MICROPY_VFS_IMPORT_CACHE (0)
+#endif
+
+// How many directories the import cache indexes at once. Each uses a heap block
+// of about eight bytes per entry.
+#ifndef MICROPY_VFS_IMPORT_CACHE_SIZE
+#define MICROPY_VFS_IMPORT_CACHE_SIZE (8)
+#endif
+
 // Whether to include support for writable filesystems.
 #ifndef MICROPY_VFS_WRITABLE
 #define MICROPY_VFS_WRITABLE (1)
@@ -88,6 +88,15 @@ typedef struct _mp_sched_item_t {
     mp_obj_t arg;
 } mp_sched_item_t;
 
+// A site lookup cache entry remembers the slot a bytecode site last found its
+// name in. The pointers are only compared, never followed, so they are not
+// traced by the GC.
+typedef struct _mp_site_lookup_cache_entry_t {
+    const byte *site;
+    const void *owner; // the type, globals map or instance shape of the last lookup, NULL for any
+    size_t slot;
+} mp_site_lookup_cache_entry_t;
+
 // gc_lock_depth field is a combination of the GC_COLLECT_FLAG
 // bit and a lock depth shifted GC_LOCK_DEPTH_SHIFT bits left.
 #if MICROPY_ENABLE_FINALISER
@@ -116,11 +125,28 @@ typedef struct _mp_state_mem_area_t {
     #if MICROPY_ENABLE_SELECTIVE_COLLECT
     byte *gc_collect_table_start;
     #endif
+    #if MICROPY_GC_FREE_RUN_INDEX
+    byte *gc_free_run_index_start;
+    #endif
     byte *gc_pool_start;
     byte *gc_pool_end;
 
     size_t gc_last_free_atb_index;
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
+
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // No free run of gc_fit_blocks or more blocks is before gc_fit_atb_index.
+    size_t gc_fit_atb_index;
+    size_t gc_fit_blocks;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Blocks gc_sweep_block up to (not including) gc_sweep_end_block are still to
+    // be swept after the last collection; live heads there are still marked.
+    size_t gc_sweep_block;
+    size_t gc_sweep_end_block;
+    size_t gc_sweep_last_used_block;
+    #endif
 } mp_state_mem_area_t;
 
 // This structure hold information about the memory allocation system.
@@ -158,6 +184,11 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Set if any area has blocks left to sweep.
+    bool gc_sweep_pending;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_recursive_mutex_t gc_mutex;
@@ -282,6 +313,11 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    #if MICROPY_OPT_SITE_LOOKUP_CACHE
+    // See mp_execute_bytecode.
+    mp_site_lookup_cache_entry_t site_lookup_cache[MICROPY_OPT_SITE_LOOKUP_CACHE_SIZE];
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
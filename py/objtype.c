@@ -30,6 +30,7 @@
 #include <string.h>
 #include <assert.h>
 
+#include "py/gc.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
 
@@ -83,6 +84,137 @@ static int instance_count_native_bases(const mp_obj_type_t *type, const mp_obj_t
     }
 }
 
+#if MICROPY_OPT_INSTANCE_SHAPES
+
+#if !MICROPY_ENABLE_GC
+#error MICROPY_OPT_INSTANCE_SHAPES requires MICROPY_ENABLE_GC
+#endif
+
+// A class made by mp_obj_new_type keeps the root of the shapes of its instances
+// in the slot after the ones that MP_OBJ_TYPE_SET_SLOT fills in for every class.
+#define INSTANCE_TYPE_SHAPE_ROOT_SLOT (10)
+#define INSTANCE_TYPE_NUM_SHAPE_SLOTS (1)
+
+// Root capacity meaning that the instances of the class have too many attributes
+// for slots, so new ones start out with a map.
+#define SHAPE_CAPACITY_NONE (0xff)
+
+static inline mp_obj_instance_shape_t *instance_type_shape_root(const mp_obj_type_t *type) {
+    return (mp_obj_instance_shape_t *)type->slots[INSTANCE_TYPE_SHAPE_ROOT_SLOT];
+}
+
+static void instance_set_shape(mp_obj_instance_t *self, const mp_obj_instance_shape_t *shape) {
+    // See mp_obj_instance_get_shape
+    self->members.is_fixed = 1;
+    self->members.used = 0;
+    self->members.alloc = 0;
+    self->members.table = (mp_map_elem_t *)(void *)shape;
+}
+
+static mp_obj_instance_shape_t *shape_new(mp_obj_instance_shape_t *parent, qstr attr) {
+    size_t n_slots = parent == NULL ? 0 : parent->n_slots + 1;
+    mp_obj_instance_shape_t *shape = m_new_obj_var_maybe(mp_obj_instance_shape_t, names, qstr_short_t, n_slots);
+    if (shape == NULL) {
+        return NULL;
+    }
+    shape->children = NULL;
+    shape->sibling = NULL;
+    shape->n_slots = n_slots;
+    shape->n_shapes = 1;
+    shape->capacity = 0;
+    if (parent != NULL) {
+        shape->slot_offset = parent->slot_offset;
+        memcpy(shape->names, parent->names, parent->n_slots * sizeof(qstr_short_t));
+        shape->names[parent->n_slots] = attr;
+        shape->sibling = parent->children;
+        parent->children = shape;
+    }
+    return shape;
+}
+
+// Store attr in a slot of an instance that has a shape. Returns false if the
+// instance needs a map to hold it.
+static bool instance_store_slot(mp_obj_instance_t *self, const mp_obj_instance_shape_t *shape, qstr attr, mp_obj_t value) {
+    int index = mp_obj_instance_shape_find(shape, attr);
+    if (index >= 0) {
+        mp_obj_instance_slots(self, shape)[index] = value;
+        return true;
+    }
+
+    // A new attribute needs a shape with one more name, and a spare slot. The
+    // instance may have more slots than were asked for, when its size was rounded
+    // up to a whole number of gc blocks.
+    mp_obj_instance_shape_t *root = instance_type_shape_root(self->base.type);
+    size_t n_slots = shape->n_slots + 1;
+    size_t capacity = (gc_nbytes(self) - sizeof(mp_obj_instance_t)) / sizeof(mp_obj_t) - shape->slot_offset;
+    if (n_slots > MICROPY_OPT_INSTANCE_SHAPES_MAX_SLOTS || attr > UINT16_MAX) {
+        root->capacity = SHAPE_CAPACITY_NONE;
+        return false;
+    }
+    if (n_slots > capacity) {
+        // Give the instances made from now on room for this attribute
+        if (root->capacity < n_slots) {
+            root->capacity = n_slots;
+        }
+        return false;
+    }
+
+    mp_obj_instance_shape_t *child = shape->children;
+    while (child != NULL && child->names[shape->n_slots] != attr) {
+        child = child->sibling;
+    }
+    if (child == NULL) {
+        if (root->n_shapes >= MICROPY_OPT_INSTANCE_SHAPES_MAX_SHAPES) {
+            return false;
+        }
+        // The parent is only written to link in the new child
+        child = shape_new((mp_obj_instance_shape_t *)shape, attr);
+        if (child == NULL) {
+            return false;
+        }
+        root->n_shapes += 1;
+    }
+    mp_obj_instance_slots(self, shape)[shape->n_slots] = value;
+    instance_set_shape(self, child);
+    return true;
+}
+
+// Note that an instance with a map has grown, so that instances made from now on
+// have room for as many attributes in their slots.
+static void instance_note_members_used(mp_obj_instance_t *self) {
+    mp_obj_instance_shape_t *root = instance_type_shape_root(self->base.type);
+    size_t used = self->members.used;
+    if (root->capacity < used && root->capacity != SHAPE_CAPACITY_NONE) {
+        root->capacity = used <= MICROPY_OPT_INSTANCE_SHAPES_MAX_SLOTS ? used : SHAPE_CAPACITY_NONE;
+    }
+}
+
+#else
+
+#define INSTANCE_TYPE_NUM_SHAPE_SLOTS (0)
+
+#endif // MICROPY_OPT_INSTANCE_SHAPES
+
+mp_map_t *mp_obj_instance_members(mp_obj_instance_t *self) {
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+    if (shape != NULL) {
+        // Fill in a new map before replacing the shape, in case allocating it fails
+        mp_obj_t *slots = mp_obj_instance_slots(self, shape);
+        mp_map_t members;
+        mp_map_init(&members, shape->n_slots);
+        for (size_t i = 0; i < shape->n_slots; i++) {
+            mp_map_lookup(&members, MP_OBJ_NEW_QSTR(shape->names[i]), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = slots[i];
+        }
+        self->members = members;
+        for (size_t i = 0; i < shape->n_slots; i++) {
+            slots[i] = MP_OBJ_NULL;
+        }
+    }
+    #endif
+    return &self->members;
+}
+
 // CIRCUITPY-CHANGE: support superclass constructors that take kw args
 // This wrapper function allows a subclass of a native type to call the
 // __init__() method (corresponding to type->make_new) of the native type.
@@ -119,8 +251,18 @@ static
 mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *class, const mp_obj_type_t **native_base) {
     size_t num_native_bases = instance_count_native_bases(class, native_base);
     assert(num_native_bases < 2);
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    mp_obj_instance_shape_t *root = instance_type_shape_root(class);
+    size_t capacity = root->capacity == SHAPE_CAPACITY_NONE ? 0 : root->capacity;
+    mp_obj_instance_t *o = mp_obj_malloc_var(mp_obj_instance_t, subobj, mp_obj_t, num_native_bases + capacity, class);
+    mp_map_init(&o->members, 0);
+    if (root->capacity != SHAPE_CAPACITY_NONE) {
+        instance_set_shape(o, root);
+    }
+    #else
     mp_obj_instance_t *o = mp_obj_malloc_var(mp_obj_instance_t, subobj, mp_obj_t, num_native_bases, class);
     mp_map_init(&o->members, 0);
+    #endif
     // Initialise the native base-class slot (should be 1 at most) with a valid
     // object.  It doesn't matter which object, so long as it can be uniquely
     // distinguished from a native class that is initialised.
@@ -438,6 +580,12 @@ static mp_obj_t instance_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
 
         size_t sz = sizeof(*self) + sizeof(*self->subobj) * num_native_bases
             + sizeof(*self->members.table) * self->members.alloc;
+        #if MICROPY_OPT_INSTANCE_SHAPES
+        const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+        if (shape != NULL) {
+            sz += sizeof(*self->subobj) * shape->n_slots;
+        }
+        #endif
         return MP_OBJ_NEW_SMALL_INT(sz);
     }
     #endif
@@ -615,20 +763,42 @@ static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
     mp_obj_instance_t *self = MP_OBJ_TO_PTR(self_in);
 
     // Note: This is fast-path'ed in the VM for the MP_BC_LOAD_ATTR operation.
-    mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
-    if (elem != NULL) {
-        // object member, always treated as a value
-        dest[0] = elem->value;
-        return;
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+    if (shape != NULL) {
+        int index = mp_obj_instance_shape_find(shape, attr);
+        if (index >= 0) {
+            dest[0] = mp_obj_instance_slots(self, shape)[index];
+            return;
+        }
+    } else
+    #endif
+    {
+        mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+        if (elem != NULL) {
+            // object member, always treated as a value
+            dest[0] = elem->value;
+            return;
+        }
     }
     #if MICROPY_CPYTHON_COMPAT
     if (attr == MP_QSTR___dict__) {
         // Create a new dict with a copy of the instance's map items.
         // This creates, unlike CPython, a read-only __dict__ that can't be modified.
-        mp_obj_dict_t dict;
-        dict.base.type = &mp_type_dict;
-        dict.map = self->members;
-        dest[0] = mp_obj_dict_copy(MP_OBJ_FROM_PTR(&dict));
+        #if MICROPY_OPT_INSTANCE_SHAPES
+        if (shape != NULL) {
+            dest[0] = mp_obj_new_dict(shape->n_slots);
+            for (size_t i = 0; i < shape->n_slots; i++) {
+                mp_obj_dict_store(dest[0], MP_OBJ_NEW_QSTR(shape->names[i]), mp_obj_instance_slots(self, shape)[i]);
+            }
+        } else
+        #endif
+        {
+            mp_obj_dict_t dict;
+            dict.base.type = &mp_type_dict;
+            dict.map = self->members;
+            dest[0] = mp_obj_dict_copy(MP_OBJ_FROM_PTR(&dict));
+        }
         mp_obj_dict_t *dest_dict = MP_OBJ_TO_PTR(dest[0]);
         dest_dict->map.is_fixed = 1;
         return;
@@ -830,6 +1000,21 @@ static bool mp_obj_instance_store_attr(mp_obj_t self_in, qstr attr, mp_obj_t val
 
 skip_special_accessors:
 
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+    if (shape != NULL) {
+        if (value == MP_OBJ_NULL) {
+            if (mp_obj_instance_shape_find(shape, attr) < 0) {
+                return false;
+            }
+        } else if (instance_store_slot(self, shape, attr, value)) {
+            return true;
+        }
+        // The instance no longer fits a shape, so move its attributes to the map
+        mp_obj_instance_members(self);
+    }
+    #endif
+
     if (value == MP_OBJ_NULL) {
         // delete attribute
         mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -837,6 +1022,9 @@ skip_special_accessors:
     } else {
         // store attribute
         mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = value;
+        #if MICROPY_OPT_INSTANCE_SHAPES
+        instance_note_members_used(self);
+        #endif
         return true;
     }
 }
@@ -1212,10 +1400,11 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     }
 
     // Allocate a variable-sized mp_obj_type_t with as many slots as we need
-    // (currently 10, plus 1 for base, plus 1 for base-protocol).
+    // (currently 10, plus 1 for the shape root, plus 1 for base, plus 1 for base-protocol).
     // Note: mp_obj_type_t is (2 + 3 + #slots) words, so going from 11 to 12 slots
     // moves from 4 to 5 gc blocks.
-    mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, slots, void *, 10 + (bases_len ? 1 : 0) + (base_protocol ? 1 : 0));
+    const size_t parent_slot = 10 + INSTANCE_TYPE_NUM_SHAPE_SLOTS;
+    mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, slots, void *, parent_slot + (bases_len ? 1 : 0) + (base_protocol ? 1 : 0));
     o->base.type = &mp_type_type;
     o->flags = base_flags;
     o->name = name;
@@ -1235,12 +1424,12 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     if (bases_len > 0) {
         if (bases_len >= 2) {
             #if MICROPY_MULTIPLE_INHERITANCE
-            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_tuple), 10);
+            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_tuple), parent_slot);
             #else
             mp_raise_NotImplementedError(MP_ERROR_TEXT("multiple inheritance not supported"));
             #endif
         } else {
-            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_items[0]), 10);
+            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_items[0]), parent_slot);
         }
 
         // Inherit protocol from a base class. This allows to define an
@@ -1248,7 +1437,7 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
         // Python method calls, and any subclass inheriting from it will
         // support this feature.
         if (base_protocol) {
-            MP_OBJ_TYPE_SET_SLOT(o, protocol, base_protocol, 11);
+            MP_OBJ_TYPE_SET_SLOT(o, protocol, base_protocol, parent_slot + 1);
         }
     }
 
@@ -1273,6 +1462,15 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
         mp_raise_TypeError(MP_ERROR_TEXT("multiple bases have instance lay-out conflict"));
     }
 
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    mp_obj_instance_shape_t *shape_root = shape_new(NULL, MP_QSTRnull);
+    if (shape_root == NULL) {
+        m_malloc_fail(sizeof(mp_obj_instance_shape_t));
+    }
+    shape_root->slot_offset = num_native_bases;
+    o->slots[INSTANCE_TYPE_SHAPE_ROOT_SLOT] = shape_root;
+    #endif
+
     mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(o, locals_dict)->map;
     mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(MP_QSTR___new__), MP_MAP_LOOKUP);
     if (elem != NULL) {
@@ -28,6 +28,24 @@
 
 #include "py/obj.h"
 
+#if MICROPY_OPT_INSTANCE_SHAPES
+// The layout of the attributes an instance keeps in slots: their names, in the
+// order they were first assigned. The shapes of the instances of a class form a
+// tree, rooted at an empty shape, where each child adds one name to its parent.
+typedef struct _mp_obj_instance_shape_t {
+    struct _mp_obj_instance_shape_t *children;
+    struct _mp_obj_instance_shape_t *sibling;
+    // index in subobj of the first slot, after any native base object
+    uint8_t slot_offset;
+    uint8_t n_slots;
+    // only used in the root: the number of shapes in the tree, and the number of
+    // slots to allocate for new instances
+    uint8_t n_shapes;
+    uint8_t capacity;
+    qstr_short_t names[];
+} mp_obj_instance_shape_t;
+#endif
+
 // instance object
 // creating an instance of a class makes one of these objects
 typedef struct _mp_obj_instance_t {
@@ -37,6 +55,33 @@ typedef struct _mp_obj_instance_t {
     // TODO maybe cache __getattr__ and __setattr__ for efficient lookup of them
 } mp_obj_instance_t;
 
+#if MICROPY_OPT_INSTANCE_SHAPES
+// Return the shape of an instance that keeps its attributes in slots, after
+// subobj's native base object, or NULL if they are in its members map. While an
+// instance has a shape its map is empty, so instead the map is marked fixed,
+// which the map of an instance otherwise never is, and its table is the shape.
+static inline const mp_obj_instance_shape_t *mp_obj_instance_get_shape(const mp_obj_instance_t *self) {
+    return self->members.is_fixed ? (const mp_obj_instance_shape_t *)(const void *)self->members.table : NULL;
+}
+
+// Return the index of the slot that holds attr, or -1 if no slot holds it.
+static inline int mp_obj_instance_shape_find(const mp_obj_instance_shape_t *shape, qstr attr) {
+    for (int i = 0; i < shape->n_slots; i++) {
+        if (shape->names[i] == attr) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static inline mp_obj_t *mp_obj_instance_slots(mp_obj_instance_t *self, const mp_obj_instance_shape_t *shape) {
+    return &self->subobj[shape->slot_offset];
+}
+#endif
+
+// Return the map of the instance's attributes, first moving them out of any slots.
+mp_map_t *mp_obj_instance_members(mp_obj_instance_t *self);
+
 #if MICROPY_CPYTHON_COMPAT
 // this is needed for object.__new__
 mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *cls, const mp_obj_type_t **native_base);
@@ -48,7 +48,7 @@
 #include "py/cstack.h"
 #include "py/gc.h"
 
-#if MICROPY_VFS_ROM && MICROPY_VFS_ROM_IOCTL
+#if (MICROPY_VFS_ROM && MICROPY_VFS_ROM_IOCTL) || MICROPY_VFS_IMPORT_CACHE
 #include "extmod/vfs.h"
 #endif
 
@@ -151,6 +151,13 @@ void mp_init(void) {
     MP_STATE_VM(vfs_mount_table) = NULL;
     #endif
 
+    #if MICROPY_VFS_IMPORT_CACHE
+    // The indexes were on the heap of the last VM, and anything kept with
+    // the generation may describe filesystems it had mounted
+    memset(MP_STATE_VM(vfs_dir_index), 0, sizeof(MP_STATE_VM(vfs_dir_index)));
+    mp_vfs_import_cache_invalidate();
+    #endif
+
     #if MICROPY_PY_SYS_PATH_ARGV_DEFAULTS
     #if MICROPY_PY_SYS_PATH
     mp_sys_path = mp_obj_new_list(0, NULL);
@@ -205,6 +205,91 @@ static mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+#if MICROPY_OPT_SITE_LOOKUP_CACHE
+// Slot value recording that the site's last lookup in this owner's map failed.
+#define SITE_CACHE_MISS ((size_t)-1)
+
+// Look up qst in map on behalf of the bytecode site, using and updating the
+// site's cache entry. A hit is only trusted if the cached slot of the map passed
+// in still holds qst, so any change that moves or removes the name invalidates
+// it, and maps with the same layout (eg instances of related classes) share it.
+// A cached miss is just a hint to take the generic path, so it can't go stale.
+// It applies to the owner it was recorded for, or to any owner once the site
+// has missed for two different owners in a row (eg a method inherited by many
+// classes), so such sites don't pay for a failing lookup on every execution.
+static mp_map_elem_t *site_cache_lookup(const byte *site, const void *owner, mp_map_t *map, qstr qst) {
+    mp_site_lookup_cache_entry_t *entry = &MP_STATE_VM(site_lookup_cache)[(uintptr_t)site % MICROPY_OPT_SITE_LOOKUP_CACHE_SIZE];
+    mp_obj_t key = MP_OBJ_NEW_QSTR(qst);
+    bool missed = false;
+    if (entry->site == site) {
+        if (entry->slot < map->alloc && map->table[entry->slot].key == key) {
+            return &map->table[entry->slot];
+        }
+        if (entry->slot == SITE_CACHE_MISS) {
+            if (entry->owner == owner || entry->owner == NULL) {
+                return NULL;
+            }
+            missed = true;
+        }
+    }
+    mp_map_elem_t *elem = mp_map_lookup(map, key, MP_MAP_LOOKUP);
+    entry->site = site;
+    entry->owner = elem == NULL && missed ? NULL : owner;
+    entry->slot = elem != NULL ? (size_t)(elem - map->table) : SITE_CACHE_MISS;
+    return elem;
+}
+
+#if MICROPY_OPT_INSTANCE_SHAPES
+// Look up qst in the slots of an instance that has a shape, on behalf of the
+// bytecode site. A hit is only trusted if the cached slot of the instance's shape
+// still has the name, so instances with shapes that share a prefix share it.
+static mp_obj_t *site_cache_lookup_slot(const byte *site, mp_obj_instance_t *self, const mp_obj_instance_shape_t *shape, qstr qst) {
+    mp_site_lookup_cache_entry_t *entry = &MP_STATE_VM(site_lookup_cache)[(uintptr_t)site % MICROPY_OPT_SITE_LOOKUP_CACHE_SIZE];
+    if (entry->site == site && entry->slot < shape->n_slots && shape->names[entry->slot] == qst) {
+        return &mp_obj_instance_slots(self, shape)[entry->slot];
+    }
+    int index = mp_obj_instance_shape_find(shape, qst);
+    if (index < 0) {
+        return NULL;
+    }
+    entry->site = site;
+    entry->owner = shape;
+    entry->slot = index;
+    return &mp_obj_instance_slots(self, shape)[index];
+}
+#endif
+
+// Fast path for LOAD_METHOD of a method defined directly in the class of an
+// instance. Returns false if the generic mp_load_method must be used.
+static bool site_cache_load_method(const byte *site, mp_obj_t obj, qstr qst, mp_obj_t *dest) {
+    const mp_obj_type_t *type = mp_obj_get_type(obj);
+    if (!mp_obj_is_instance_type(type) || !MP_OBJ_TYPE_HAS_SLOT(type, locals_dict)
+        || qst == MP_QSTR___class__ || qst == MP_QSTR___next__) {
+        return false;
+    }
+    mp_map_elem_t *elem = site_cache_lookup(site, type, &MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map, qst);
+    if (elem == NULL || !mp_obj_is_type(elem->value, &mp_type_fun_bc)) {
+        return false;
+    }
+    // Instance members shadow the class, so they must be checked every time.
+    mp_obj_instance_t *self = MP_OBJ_TO_PTR(obj);
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+    if (shape != NULL) {
+        if (mp_obj_instance_shape_find(shape, qst) >= 0) {
+            return false;
+        }
+    } else
+    #endif
+    if (mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP) != NULL) {
+        return false;
+    }
+    dest[0] = elem->value;
+    dest[1] = obj;
+    return true;
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -410,6 +495,14 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_GLOBAL): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_SITE_LOOKUP_CACHE
+                    mp_map_t *globals_map = &mp_globals_get()->map;
+                    mp_map_elem_t *elem = site_cache_lookup(ip, globals_map, globals_map, qst);
+                    if (elem != NULL) {
+                        PUSH(elem->value);
+                        DISPATCH();
+                    }
+                    #endif
                     PUSH(mp_load_global(qst));
                     DISPATCH();
                 }
@@ -420,7 +513,31 @@ dispatch_loop:
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
                     mp_obj_t obj;
-                    #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
+                    #if MICROPY_OPT_SITE_LOOKUP_CACHE
+                    // Instance members are looked up in a different map for each
+                    // instance, but instances of a class usually share a layout.
+                    const mp_obj_type_t *type = mp_obj_get_type(top);
+                    if (mp_obj_is_instance_type(type)) {
+                        mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
+                        #if MICROPY_OPT_INSTANCE_SHAPES
+                        const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+                        if (shape != NULL) {
+                            mp_obj_t *slot = site_cache_lookup_slot(ip, self, shape, qst);
+                            if (slot != NULL) {
+                                SET_TOP(*slot);
+                                DISPATCH();
+                            }
+                        } else
+                        #endif
+                        {
+                            mp_map_elem_t *elem = site_cache_lookup(ip, type, &self->members, qst);
+                            if (elem != NULL) {
+                                SET_TOP(elem->value);
+                                DISPATCH();
+                            }
+                        }
+                    }
+                    #elif MICROPY_OPT_LOAD_ATTR_FAST_PATH
                     // For the specific case of an instance type, it implements .attr
                     // and forwards to its members map. Attribute lookups on instance
                     // types are extremely common, so avoid all the other checks and
@@ -428,7 +545,19 @@ dispatch_loop:
                     mp_map_elem_t *elem = NULL;
                     if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
                         mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
-                        elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+                        #if MICROPY_OPT_INSTANCE_SHAPES
+                        const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(self);
+                        if (shape != NULL) {
+                            int index = mp_obj_instance_shape_find(shape, qst);
+                            if (index >= 0) {
+                                SET_TOP(mp_obj_instance_slots(self, shape)[index]);
+                                DISPATCH();
+                            }
+                        } else
+                        #endif
+                        {
+                            elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+                        }
                     }
                     if (elem) {
                         obj = elem->value;
@@ -444,7 +573,12 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
-                    mp_load_method(*sp, qst, sp);
+                    #if MICROPY_OPT_SITE_LOOKUP_CACHE
+                    if (!site_cache_load_method(ip, *sp, qst, sp))
+                    #endif
+                    {
+                        mp_load_method(*sp, qst, sp);
+                    }
                     sp += 1;
                     DISPATCH();
                 }
@@ -0,0 +1,159 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/BufferedSample.h"
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE
+
+//| class BufferedSample:
+//|     """Read another sample ahead of playback
+//|
+//|     Most samples produce their data only when the audio output asks for it,
+//|     so a slow file read or decode can leave the output with nothing to play,
+//|     which is heard as a dropout. A `BufferedSample` reads its sample into a
+//|     ring buffer ahead of time, from a background task, and plays from the
+//|     ring. If the ring runs dry anyway, silence is played and `underruns` is
+//|     incremented.
+//|
+//|     The ring holds about `lead_time` seconds of audio, and is filled
+//|     completely when playback starts or loops."""
+//|
+//|     def __init__(self, sample: circuitpython_typing.AudioSample, *, lead_time: float = 0.1) -> None:
+//|         """Create a BufferedSample that plays ``sample``.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to read ahead. It should
+//|           not be played or used elsewhere while the BufferedSample is in use.
+//|         :param float lead_time: How far ahead to read, in seconds, up to 10
+//|
+//|         Playing an MP3 file from an SD card::
+//|
+//|           import audiocore
+//|           import audiomp3
+//|
+//|           mp3 = audiomp3.MP3Decoder("/sd/song.mp3")
+//|           a.play(audiocore.BufferedSample(mp3, lead_time=0.25))
+//|         """
+//|         ...
+//|
+static mp_obj_t audioio_bufferedsample_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_lead_time };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_lead_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t lead_time = MICROPY_FLOAT_CONST(0.1);
+    if (args[ARG_lead_time].u_obj != mp_const_none) {
+        lead_time = mp_arg_validate_obj_float_range(args[ARG_lead_time].u_obj, 0, 10, MP_QSTR_lead_time);
+    }
+
+    audioio_bufferedsample_obj_t *self = mp_obj_malloc(audioio_bufferedsample_obj_t, &audioio_bufferedsample_type);
+    common_hal_audioio_bufferedsample_construct(self, args[ARG_sample].u_obj, lead_time);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the BufferedSample and releases all memory resources for reuse."""
+//|         ...
+//|
+static mp_obj_t audioio_bufferedsample_deinit(mp_obj_t self_in) {
+    audioio_bufferedsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_bufferedsample_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audioio_bufferedsample_deinit_obj, audioio_bufferedsample_deinit);
+
+//|     def __enter__(self) -> BufferedSample:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     lead_time: float
+//|     """How far ahead the sample is read, in seconds. (read only)"""
+//|
+static mp_obj_t audioio_bufferedsample_obj_get_lead_time(mp_obj_t self_in) {
+    audioio_bufferedsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return mp_obj_new_float(common_hal_audioio_bufferedsample_get_lead_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_bufferedsample_get_lead_time_obj, audioio_bufferedsample_obj_get_lead_time);
+
+MP_PROPERTY_GETTER(audioio_bufferedsample_lead_time_obj,
+    (mp_obj_t)&audioio_bufferedsample_get_lead_time_obj);
+
+//|     underruns: int
+//|     """The number of times the ring ran dry and silence was played instead. (read only)"""
+//|
+static mp_obj_t audioio_bufferedsample_obj_get_underruns(mp_obj_t self_in) {
+    audioio_bufferedsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return mp_obj_new_int_from_uint(common_hal_audioio_bufferedsample_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_bufferedsample_get_underruns_obj, audioio_bufferedsample_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_bufferedsample_underruns_obj,
+    (mp_obj_t)&audioio_bufferedsample_get_underruns_obj);
+
+//|     sample_rate: int
+//|     """32 bit value that dictates how quickly samples are played in Hertz (cycles per second).
+//|     When the sample is looped, this can change the pitch output without changing the underlying
+//|     sample."""
+
+//|     bits_per_sample: int
+//|     """Bits per sample. (read only)"""
+//
+//|     channel_count: int
+//|     """Number of audio channels. (read only)"""
+//|
+//|
+
+static const mp_rom_map_elem_t audioio_bufferedsample_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_bufferedsample_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_lead_time), MP_ROM_PTR(&audioio_bufferedsample_lead_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_bufferedsample_underruns_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audioio_bufferedsample_locals_dict, audioio_bufferedsample_locals_dict_table);
+
+static const audiosample_p_t audioio_bufferedsample_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_bufferedsample_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_bufferedsample_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioio_bufferedsample_type,
+    MP_QSTR_BufferedSample,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioio_bufferedsample_make_new,
+    locals_dict, &audioio_bufferedsample_locals_dict,
+    protocol, &audioio_bufferedsample_proto
+    );
+
+#endif
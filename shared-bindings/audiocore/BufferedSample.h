@@ -0,0 +1,19 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/BufferedSample.h"
+
+extern const mp_obj_type_t audioio_bufferedsample_type;
+
+void common_hal_audioio_bufferedsample_construct(audioio_bufferedsample_obj_t *self,
+    mp_obj_t sample, mp_float_t lead_time);
+
+void common_hal_audioio_bufferedsample_deinit(audioio_bufferedsample_obj_t *self);
+
+mp_float_t common_hal_audioio_bufferedsample_get_lead_time(audioio_bufferedsample_obj_t *self);
+uint32_t common_hal_audioio_bufferedsample_get_underruns(audioio_bufferedsample_obj_t *self);
@@ -0,0 +1,190 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/enum.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_AUDIOCORE_RESAMPLER
+
+//| class ResamplerQuality:
+//|     """How an `audiocore.Resampler` filters the sample. Higher quality takes more time."""
+//|
+//|     LOW: ResamplerQuality
+//|     """Linear interpolation between pairs of frames. Fastest, but adds some noise
+//|     and dulls high frequencies."""
+//|
+//|     MEDIUM: ResamplerQuality
+//|     """An 8 tap windowed sinc filter."""
+//|
+//|     HIGH: ResamplerQuality
+//|     """A 16 tap windowed sinc filter."""
+//|
+//|
+MAKE_ENUM_VALUE(audioio_resampler_quality_type, resampler_quality, LOW, RESAMPLER_QUALITY_LOW);
+MAKE_ENUM_VALUE(audioio_resampler_quality_type, resampler_quality, MEDIUM, RESAMPLER_QUALITY_MEDIUM);
+MAKE_ENUM_VALUE(audioio_resampler_quality_type, resampler_quality, HIGH, RESAMPLER_QUALITY_HIGH);
+
+MAKE_ENUM_MAP(audioio_resampler_quality) {
+    MAKE_ENUM_MAP_ENTRY(resampler_quality, LOW),
+    MAKE_ENUM_MAP_ENTRY(resampler_quality, MEDIUM),
+    MAKE_ENUM_MAP_ENTRY(resampler_quality, HIGH),
+};
+
+static MP_DEFINE_CONST_DICT(audioio_resampler_quality_locals_dict, audioio_resampler_quality_locals_table);
+
+MAKE_PRINTER(audiocore, audioio_resampler_quality);
+
+MAKE_ENUM_TYPE(audiocore, ResamplerQuality, audioio_resampler_quality);
+
+//| class Resampler:
+//|     """Play another sample at a different sample rate
+//|
+//|     Mixers, effects and outputs need all of their samples to have the same
+//|     sample rate. A `Resampler` converts a sample's rate as it plays, so that
+//|     samples recorded at different rates can be played together without
+//|     storing a copy of each at every rate. The pitch and speed of the sample
+//|     are unchanged.
+//|
+//|     The other properties of the sample, such as its channel count and bits per
+//|     sample, are passed through."""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         sample_rate: int,
+//|         quality: ResamplerQuality = ResamplerQuality.MEDIUM,
+//|         buffer_size: int = 1024,
+//|     ) -> None:
+//|         """Create a Resampler that plays ``sample`` at ``sample_rate``.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to resample. It should
+//|           not be played or used elsewhere while the Resampler is in use.
+//|         :param int sample_rate: The sample rate to convert to, in Hertz
+//|         :param ResamplerQuality quality: How well to filter the sample
+//|         :param int buffer_size: The total size in bytes of each of the two playback buffers to use
+//|
+//|         Playing a 22.05 kHz sound effect through a 44.1 kHz mixer::
+//|
+//|           import audiocore
+//|           import audiomixer
+//|
+//|           mixer = audiomixer.Mixer(voice_count=2, sample_rate=44100, channel_count=1)
+//|           a.play(mixer)
+//|           effect = audiocore.WaveFile("laser_22050.wav")
+//|           mixer.voice[1].play(audiocore.Resampler(effect, sample_rate=44100))
+//|         """
+//|         ...
+//|
+static mp_obj_t audioio_resampler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_sample_rate, ARG_quality, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_sample_rate, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_quality, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    audioio_resampler_quality_t quality = RESAMPLER_QUALITY_MEDIUM;
+    if (args[ARG_quality].u_obj != MP_OBJ_NULL) {
+        quality = cp_enum_value(&audioio_resampler_quality_type, args[ARG_quality].u_obj, MP_QSTR_quality);
+    }
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audioio_resampler_obj_t *self = mp_obj_malloc(audioio_resampler_obj_t, &audioio_resampler_type);
+    common_hal_audioio_resampler_construct(self, args[ARG_sample].u_obj, sample_rate, quality, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Resampler and releases all memory resources for reuse.
+//|         The wrapped sample is not deinitialised."""
+//|         ...
+//|
+static mp_obj_t audioio_resampler_deinit(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_resampler_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_deinit_obj, audioio_resampler_deinit);
+
+//|     def __enter__(self) -> Resampler:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     quality: ResamplerQuality
+//|     """How well the sample is filtered. (read only)"""
+//|
+static mp_obj_t audioio_resampler_obj_get_quality(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return cp_enum_find(&audioio_resampler_quality_type, common_hal_audioio_resampler_get_quality(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_quality_obj, audioio_resampler_obj_get_quality);
+
+MP_PROPERTY_GETTER(audioio_resampler_quality_obj,
+    (mp_obj_t)&audioio_resampler_get_quality_obj);
+
+//|     sample_rate: int
+//|     """32 bit value that dictates how quickly samples are played in Hertz (cycles per second).
+//|     This is the rate that the sample is converted to."""
+//|
+//|     bits_per_sample: int
+//|     """Bits per sample. (read only)"""
+//|
+//|     channel_count: int
+//|     """Number of audio channels. (read only)"""
+//|
+//|
+
+static const mp_rom_map_elem_t audioio_resampler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_resampler_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_quality), MP_ROM_PTR(&audioio_resampler_quality_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audioio_resampler_locals_dict, audioio_resampler_locals_dict_table);
+
+static const audiosample_p_t audioio_resampler_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_resampler_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_resampler_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioio_resampler_type,
+    MP_QSTR_Resampler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioio_resampler_make_new,
+    locals_dict, &audioio_resampler_locals_dict,
+    protocol, &audioio_resampler_proto
+    );
+
+#endif
@@ -21,7 +21,13 @@
 //|     be 8 bit unsigned or 16 bit signed. If a buffer is provided, it will be used instead of allocating
 //|     an internal buffer, which can prevent memory fragmentation."""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self,
+//|         file: Union[str, typing.BinaryIO],
+//|         buffer: Optional[WriteableBuffer] = None,
+//|         *,
+//|         chunk_size: int = 0,
+//|     ) -> None:
 //|         """Load a .wav file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param Union[str, typing.BinaryIO] file: The name of a wave file (preferred) or an already opened wave file
@@ -29,7 +35,13 @@
 //|           that will be split in half and used for double-buffering of the data.
 //|           The buffer must be 8 to 1024 bytes long.
 //|           If not provided, two 256 byte buffers are initially allocated internally.
-//|
+//|         :param int chunk_size: When not zero, the file is streamed in chunks of this many
+//|           bytes instead, rounded up to a multiple of 512. Three chunks are allocated outside
+//|           the VM heap and played from directly, and the next chunk is read ahead in the
+//|           background. Reads are aligned to the file system's sectors, so a multiple of the
+//|           cluster size, such as 4096, reads fastest. Uses more memory, but much less
+//|           time when playing large files from an SD card. ``buffer`` is not used.
+
 //|         Playing a wave file from flash::
 //|
 //|           import board
@@ -52,28 +64,42 @@
 //|         """
 //|         ...
 //|
-static mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
-    mp_obj_t arg = args[0];
+static mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_file, ARG_buffer, ARG_chunk_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_chunk_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t arg = args[ARG_file].u_obj;
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
 
-    audioio_wavefile_obj_t *self = mp_obj_malloc(audioio_wavefile_obj_t, &audioio_wavefile_type);
+    // Chunks are allocated outside the VM heap, so they must be freed
+    audioio_wavefile_obj_t *self = mp_obj_malloc_with_finaliser(audioio_wavefile_obj_t, &audioio_wavefile_type);
     if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 1024, MP_QSTR_buffer);
     }
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+    uint32_t chunk_size = mp_arg_validate_int_range(args[ARG_chunk_size].u_int, 0, 32768, MP_QSTR_chunk_size);
+    chunk_size = (chunk_size + 511) & ~511;
+    #else
+    uint32_t chunk_size = mp_arg_validate_int_range(args[ARG_chunk_size].u_int, 0, 0, MP_QSTR_chunk_size);
+    #endif
     common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(arg),
-        buffer, buffer_size);
+        buffer, buffer_size, chunk_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -118,6 +144,7 @@ static MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_deinit_obj, audioio_wavefile_d
 static const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_wavefile_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audioio_wavefile_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
 
@@ -7,12 +7,17 @@
 #include <stdint.h>
 
 #include "py/obj.h"
+#include "py/objnamedtuple.h"
 #include "py/objproperty.h"
 #include "py/gc.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
+#include "py/stream.h"
 
 #include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/audiocore/BufferedSample.h"
 #include "shared-bindings/audiocore/RawSample.h"
+#include "shared-bindings/audiocore/Resampler.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/util.h"
 // #include "shared-bindings/audiomixer/Mixer.h"
@@ -79,10 +84,210 @@ static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_reset_buffer_obj, audiocore_reset_buf
 
 #endif
 
+#if CIRCUITPY_AUDIOCORE_STATS
+//| class Stats:
+//|     """Profile of the calls that an audio output, mixer or effect made to get a sample's data,
+//|     as returned by `stats`. Times include the time taken by the sample's own sources,
+//|     so an effect's time includes that of the sample it plays. The timer's resolution
+//|     depends on the port, and is about 30 microseconds on most."""
+//|
+//|     calls: int
+//|     """The number of times the sample was asked for data"""
+//|
+//|     frames: int
+//|     """The number of frames the sample produced"""
+//|
+//|     time_us: int
+//|     """The total time taken to produce them, in microseconds. ``frames / sample_rate``
+//|     divided by ``time_us / 1e6`` is how many times faster than real time the sample is."""
+//|
+//|     max_time_us: int
+//|     """The longest time taken by one call, in microseconds"""
+//|
+//|     late: int
+//|     """The number of buffers that took longer to produce than to play. Unless they were
+//|     read ahead, such as by `BufferedSample`, each one is likely to have been heard as
+//|     a glitch."""
+//|
+//|     stalls: int
+//|     """The number of times the sample had no data ready yet, and played nothing"""
+//|
+//|     errors: int
+//|     """The number of times the sample failed to produce data, such as from a read error"""
+//|
+//|     underruns: int
+//|     """The number of times audio output ran out of the sample's data because its next
+//|     buffer wasn't ready in time, and was heard as a glitch. Counted for the sample an
+//|     output plays directly by `audiobusio.I2SOut` on Espressif and by the DMA based
+//|     outputs on Atmel SAMD and Raspberry Pi; other ports report 0. A `BufferedSample`
+//|     counts each time its ring runs dry."""
+//|
+//|
+const mp_obj_namedtuple_type_t audiocore_stats_type_obj = {
+    NAMEDTUPLE_TYPE_BASE_AND_SLOTS(MP_QSTR_Stats),
+    .n_fields = 8,
+    .fields = {
+        MP_QSTR_calls,
+        MP_QSTR_frames,
+        MP_QSTR_time_us,
+        MP_QSTR_max_time_us,
+        MP_QSTR_late,
+        MP_QSTR_stalls,
+        MP_QSTR_errors,
+        MP_QSTR_underruns,
+    },
+};
+
+//| def stats(sample: circuitpython_typing.AudioSample, *, reset: bool = False) -> Stats:
+//|     """Return the `Stats` kept for ``sample`` since it was created or last reset.
+//|     Every sample in a playback graph keeps its own, so the one that is too slow can be found::
+//|
+//|       import audiocore
+//|
+//|       a.play(mixer)
+//|       time.sleep(10)
+//|       for sample in (mixer, echo, wave):
+//|           print(audiocore.stats(sample, reset=True))
+//|
+//|     Available on full builds, or others made with ``CIRCUITPY_AUDIOCORE_STATS = 1``.
+//|
+//|     :param ~circuitpython_typing.AudioSample sample: The sample to report on
+//|     :param bool reset: Clear the stats after returning them
+//|     """
+//|     ...
+//|
+static mp_obj_t audiocore_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_reset, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    audiosample_base_t *sample = audiosample_check(args[ARG_sample].u_obj);
+    // Copy the stats first, because they may be updated by an interrupt
+    audiosample_stats_t stats = sample->stats;
+    if (args[ARG_reset].u_bool) {
+        memset(&sample->stats, 0, sizeof(sample->stats));
+    }
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(stats.calls),
+        mp_obj_new_int_from_uint(stats.frames),
+        mp_obj_new_int_from_ull(stats.time_us),
+        mp_obj_new_int_from_uint(stats.max_time_us),
+        mp_obj_new_int_from_uint(stats.late),
+        mp_obj_new_int_from_uint(stats.stalls),
+        mp_obj_new_int_from_uint(stats.errors),
+        mp_obj_new_int_from_uint(stats.underruns),
+    };
+    return namedtuple_make_new((const mp_obj_type_t *)&audiocore_stats_type_obj, MP_ARRAY_SIZE(items), 0, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_stats_obj, 1, audiocore_stats);
+#endif
+
+#if CIRCUITPY_AUDIOCORE_RENDER
+//| def render(
+//|     sample: circuitpython_typing.AudioSample,
+//|     output: Union[WriteableBuffer, circuitpython_typing.ByteStream],
+//|     frames: Optional[int] = None,
+//|     *,
+//|     reset: bool = True,
+//| ) -> int:
+//|     """Play a sample from the start into a buffer or a file, as fast as it can be
+//|     produced, instead of through an audio output. This can precompute sounds from a
+//|     `synthio.Synthesizer`, `audiomixer.Mixer` or chain of effects, or measure how fast
+//|     they run.
+//|
+//|     The data is in the sample's own format: interleaved frames of ``bits_per_sample``
+//|     bit samples, signed or unsigned as the sample produces them. A sample being rendered
+//|     must not be playing elsewhere at the same time.
+//|
+//|     :param ~circuitpython_typing.AudioSample sample: The sample to render
+//|     :param ~circuitpython_typing.WriteableBuffer output: A buffer, such as an
+//|       `array.array` of type ``h``, or a file opened in binary mode
+//|     :param int frames: The number of frames to render. By default, a buffer is filled,
+//|       while a file is written until the sample ends. Mixers, synthesizers and effects
+//|       never end, so need ``frames``.
+//|     :param bool reset: Start the sample from the beginning, as an audio output does when it
+//|       starts to play it. Pass ``False`` to continue from where the last render stopped, such as
+//|       to render a long sound in pieces; the rest of the sample's last buffer is skipped, so
+//|       each piece should be a whole number of its ``buffer_size``. A `audiomixer.Mixer` stops
+//|       its voices when it is reset, so is rendered with ``reset=False`` after they are played.
+//|     :return: The number of frames rendered, which is less than ``frames`` if the sample ended first
+//|
+//|     Rendering a second of a chord, to play many times later::
+//|
+//|       import array
+//|       import audiocore
+//|       import synthio
+//|
+//|       synth = synthio.Synthesizer(sample_rate=22050)
+//|       synth.press((60, 64, 67))
+//|       chord = array.array("h", [0] * 22050)
+//|       audiocore.render(synth, chord)
+//|       a.play(audiocore.RawSample(chord, sample_rate=22050), loop=True)
+//|     """
+//|     ...
+//|
+static mp_obj_t audiocore_render(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_output, ARG_frames, ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_output, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_frames, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_reset, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    audiosample_base_t *sample = audiosample_check(args[ARG_sample].u_obj);
+    audiosample_check_for_deinit(sample);
+    uint32_t bytes_per_frame = sample->channel_count * sample->bits_per_sample / 8;
+
+    mp_buffer_info_t bufinfo;
+    uint8_t *buffer = NULL;
+    mp_obj_t stream = MP_OBJ_NULL;
+    mp_int_t max_frames = MP_SMALL_INT_MAX;
+    if (mp_get_buffer(args[ARG_output].u_obj, &bufinfo, MP_BUFFER_WRITE)) {
+        buffer = bufinfo.buf;
+        max_frames = bufinfo.len / bytes_per_frame;
+    } else {
+        stream = args[ARG_output].u_obj;
+        const mp_stream_p_t *proto = mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
+        if (proto->is_text) {
+            mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
+        }
+    }
+
+    mp_int_t frames = max_frames;
+    if (args[ARG_frames].u_obj != mp_const_none) {
+        frames = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_frames].u_obj), 0, max_frames, MP_QSTR_frames);
+    }
+
+    return mp_obj_new_int_from_uint(audiosample_render(args[ARG_sample].u_obj, buffer, stream, frames, args[ARG_reset].u_bool));
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_render_obj, 2, audiocore_render);
+#endif
+
 static const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
+    #if CIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE
+    { MP_ROM_QSTR(MP_QSTR_BufferedSample), MP_ROM_PTR(&audioio_bufferedsample_type) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
+    #if CIRCUITPY_AUDIOCORE_RESAMPLER
+    { MP_ROM_QSTR(MP_QSTR_Resampler), MP_ROM_PTR(&audioio_resampler_type) },
+    { MP_ROM_QSTR(MP_QSTR_ResamplerQuality), MP_ROM_PTR(&audioio_resampler_quality_type) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
+    #if CIRCUITPY_AUDIOCORE_RENDER
+    { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&audiocore_render_obj) },
+    #endif
+    #if CIRCUITPY_AUDIOCORE_STATS
+    { MP_ROM_QSTR(MP_QSTR_Stats), MP_ROM_PTR(&audiocore_stats_type_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&audiocore_stats_obj) },
+    #endif
     #if CIRCUITPY_AUDIOCORE_DEBUG
     { MP_ROM_QSTR(MP_QSTR_get_buffer), MP_ROM_PTR(&audiocore_get_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_buffer), MP_ROM_PTR(&audiocore_reset_buffer_obj) },
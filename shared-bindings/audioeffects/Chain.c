@@ -0,0 +1,220 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared-bindings/audioeffects/Chain.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+
+//| class Chain:
+//|     """Apply several effects to a sample, one after another
+//|
+//|     Effects can be chained by playing one into another, as in
+//|     ``echo.play(distortion.play(sample))``, but then each effect reads, converts
+//|     and buffers the samples separately. A `Chain` reads the sample once, converts
+//|     each block of it once to 32 bit values, has every effect change the block in
+//|     turn, and converts it back once at the end. This takes much less time and
+//|     memory when several effects are used together.
+//|
+//|     The supported effects are `audiodelays.Echo`, `audiodelays.Chorus`,
+//|     `audiodelays.PitchShift`, `audiodelays.MultiTapDelay`,
+//|     `audiofilters.Distortion`, `audiofilters.Filter`, `audiofilters.Phaser` and
+//|     `audiofreeverb.Freeverb`. Their settings, such as ``mix``, apply as usual
+//|     and may be changed while the chain is playing. An effect in a chain should
+//|     not be played on its own at the same time.
+//|
+//|     Between effects, samples stay in the 16 bit range, so the result is the same
+//|     as playing the effects into one another. 8 bit samples are processed as 16
+//|     bit samples."""
+//|
+//|     def __init__(
+//|         self,
+//|         effects: Sequence[circuitpython_typing.AudioSample],
+//|         *,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Create a chain of effects. The chain's encoding is that of the effects,
+//|         which must all have the same sample rate, channel count, bits per sample
+//|         and signedness.
+//|
+//|         :param Sequence effects: The effects to apply, in order
+//|         :param int buffer_size: The total size in bytes of each of the two playback buffers to use
+//|
+//|         Playing a sample through a distortion followed by an echo::
+//|
+//|           import board
+//|           import audiobusio
+//|           import audiocore
+//|           import audiodelays
+//|           import audioeffects
+//|           import audiofilters
+//|
+//|           audio = audiobusio.I2SOut(bit_clock=board.GP20, word_select=board.GP21, data=board.GP22)
+//|           wave = audiocore.WaveFile("guitar.wav")
+//|           settings = dict(sample_rate=wave.sample_rate, channel_count=wave.channel_count)
+//|           distortion = audiofilters.Distortion(drive=0.7, mode=audiofilters.DistortionMode.OVERDRIVE, **settings)
+//|           echo = audiodelays.Echo(max_delay_ms=500, delay_ms=250, decay=0.6, **settings)
+//|           chain = audioeffects.Chain((distortion, echo))
+//|           audio.play(chain)
+//|           chain.play(wave, loop=True)"""
+//|         ...
+//|
+static mp_obj_t audioeffects_chain_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_effects, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_effects, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t effect_count;
+    mp_obj_t *effects;
+    mp_obj_get_array(args[ARG_effects].u_obj, &effect_count, &effects);
+    mp_arg_validate_length_min(effect_count, 1, MP_QSTR_effects);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audioeffects_chain_obj_t *self = mp_obj_malloc(audioeffects_chain_obj_t, &audioeffects_chain_type);
+    common_hal_audioeffects_chain_construct(self, effect_count, effects, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Chain. The effects are not deinitialised."""
+//|         ...
+//|
+static mp_obj_t audioeffects_chain_deinit(mp_obj_t self_in) {
+    audioeffects_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioeffects_chain_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_chain_deinit_obj, audioeffects_chain_deinit);
+
+//|     def __enter__(self) -> Chain:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     effects: Tuple[circuitpython_typing.AudioSample, ...]
+//|     """The effects, in the order they are applied. (read-only)"""
+//|
+static mp_obj_t audioeffects_chain_obj_get_effects(mp_obj_t self_in) {
+    audioeffects_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return common_hal_audioeffects_chain_get_effects(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_chain_get_effects_obj, audioeffects_chain_obj_get_effects);
+
+MP_PROPERTY_GETTER(audioeffects_chain_effects_obj,
+    (mp_obj_t)&audioeffects_chain_get_effects_obj);
+
+//|     playing: bool
+//|     """True when the chain is playing a sample. (read-only)"""
+//|
+static mp_obj_t audioeffects_chain_obj_get_playing(mp_obj_t self_in) {
+    audioeffects_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return mp_obj_new_bool(common_hal_audioeffects_chain_get_playing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_chain_get_playing_obj, audioeffects_chain_obj_get_playing);
+
+MP_PROPERTY_GETTER(audioeffects_chain_playing_obj,
+    (mp_obj_t)&audioeffects_chain_get_playing_obj);
+
+//|     def play(self, sample: circuitpython_typing.AudioSample, *, loop: bool = False) -> Chain:
+//|         """Plays the sample once when loop=False and continuously when loop=True.
+//|         Does not block. Use `playing` to block.
+//|
+//|         The sample must match the encoding of the effects.
+//|
+//|         :return: The chain itself, so it can be played directly, ie:
+//|           ``audio.play(chain.play(sample))``.
+//|         :rtype: Chain"""
+//|         ...
+//|
+static mp_obj_t audioeffects_chain_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_loop };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample,    MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_loop,      MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    audioeffects_chain_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    audiosample_check_for_deinit(&self->base);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    common_hal_audioeffects_chain_play(self, args[ARG_sample].u_obj, args[ARG_loop].u_bool);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audioeffects_chain_play_obj, 1, audioeffects_chain_obj_play);
+
+//|     def stop(self) -> None:
+//|         """Stops playback of the sample. The effects continue on silence, so echoes
+//|         and reverb die away."""
+//|         ...
+//|
+static mp_obj_t audioeffects_chain_obj_stop(mp_obj_t self_in) {
+    audioeffects_chain_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioeffects_chain_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_chain_stop_obj, audioeffects_chain_obj_stop);
+
+//|     sample_rate: int
+//|     """32 bit value that dictates how quickly samples are played in Hertz (cycles per second). (read only)"""
+//|
+//|     bits_per_sample: int
+//|     """Bits per sample. (read only)"""
+//|
+//|     channel_count: int
+//|     """Number of audio channels. (read only)"""
+//|
+//|
+
+static const mp_rom_map_elem_t audioeffects_chain_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioeffects_chain_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&audioeffects_chain_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audioeffects_chain_stop_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_effects), MP_ROM_PTR(&audioeffects_chain_effects_obj) },
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioeffects_chain_playing_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audioeffects_chain_locals_dict, audioeffects_chain_locals_dict_table);
+
+static const audiosample_p_t audioeffects_chain_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audioeffects_chain_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioeffects_chain_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioeffects_chain_type,
+    MP_QSTR_Chain,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioeffects_chain_make_new,
+    locals_dict, &audioeffects_chain_locals_dict,
+    protocol, &audioeffects_chain_proto
+    );
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audioeffects/Chain.h"
+
+extern const mp_obj_type_t audioeffects_chain_type;
+
+void common_hal_audioeffects_chain_construct(audioeffects_chain_obj_t *self,
+    size_t effect_count, const mp_obj_t *effects, uint32_t buffer_size);
+
+void common_hal_audioeffects_chain_deinit(audioeffects_chain_obj_t *self);
+
+mp_obj_t common_hal_audioeffects_chain_get_effects(audioeffects_chain_obj_t *self);
+
+bool common_hal_audioeffects_chain_get_playing(audioeffects_chain_obj_t *self);
+void common_hal_audioeffects_chain_play(audioeffects_chain_obj_t *self, mp_obj_t sample, bool loop);
+void common_hal_audioeffects_chain_stop(audioeffects_chain_obj_t *self);
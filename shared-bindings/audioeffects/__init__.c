@@ -0,0 +1,34 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audioeffects/__init__.h"
+#include "shared-bindings/audioeffects/Chain.h"
+
+//| """Support for combining audio effects
+//|
+//| The `audioeffects` module contains classes to apply the effects from `audiodelays`,
+//| `audiofilters` and `audiofreeverb` together.
+//|
+//| """
+
+static const mp_rom_map_elem_t audioeffects_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audioeffects) },
+    { MP_ROM_QSTR(MP_QSTR_Chain), MP_ROM_PTR(&audioeffects_chain_type) },
+};
+
+static MP_DEFINE_CONST_DICT(audioeffects_module_globals, audioeffects_module_globals_table);
+
+const mp_obj_module_t audioeffects_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&audioeffects_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_audioeffects, audioeffects_module);
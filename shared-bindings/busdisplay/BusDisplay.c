@@ -17,6 +17,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/util.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/warnings/__init__.h"
 
 //| import displayio
 //| import fourwire
@@ -67,6 +68,7 @@
 //|         native_frames_per_second: int = 60,
 //|         backlight_on_high: bool = True,
 //|         SH1107_addressing: bool = False,
+//|         refresh_buffer_size: int = 0,
 //|     ) -> None:
 //|         r"""Create a Display object on the given display bus (`FourWire`, `paralleldisplaybus.ParallelBus` or `I2CDisplayBus`).
 //|
@@ -124,6 +126,7 @@
 //|         :param bool SH1107_addressing: Special quirk for SH1107, use upper/lower column set and page set
 //|         :param int set_vertical_scroll: This parameter is accepted but ignored for backwards compatibility. It will be removed in a future release.
 //|         :param int backlight_pwm_frequency: The frequency to use to drive the PWM for backlight brightness control. Default is 50000.
+//|         :param int refresh_buffer_size: Size in bytes of a DMA capable pixel buffer to allocate outside of the VM heap for refreshes. Larger buffers send more pixels per bus transaction and need fewer address window updates. 0 uses a 512 byte buffer on the stack, as does a size that can't be allocated, after a warning.
 //|         """
 //|         ...
 //|
@@ -136,7 +139,7 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
            ARG_set_vertical_scroll, ARG_backlight_pin, ARG_brightness_command,
            ARG_brightness, ARG_single_byte_bounds, ARG_data_as_commands,
            ARG_auto_refresh, ARG_native_frames_per_second, ARG_backlight_on_high,
-           ARG_SH1107_addressing, ARG_backlight_pwm_frequency };
+           ARG_SH1107_addressing, ARG_backlight_pwm_frequency, ARG_refresh_buffer_size };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_init_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -164,7 +167,8 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         { MP_QSTR_native_frames_per_second, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 60} },
         { MP_QSTR_backlight_on_high, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_SH1107_addressing, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
-        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} }
+        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} },
+        { MP_QSTR_refresh_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -190,6 +194,8 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be 1 when %q is True"), MP_QSTR_color_depth, MP_QSTR_SH1107_addressing);
     }
 
+    const mp_int_t refresh_buffer_size = mp_arg_validate_int_min(args[ARG_refresh_buffer_size].u_int, 0, MP_QSTR_refresh_buffer_size);
+
     primary_display_t *disp = allocate_display_or_raise();
     busdisplay_busdisplay_obj_t *self = &disp->display;
 
@@ -216,6 +222,12 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         sh1107_addressing,
         args[ARG_backlight_pwm_frequency].u_int
         );
+    if (!common_hal_busdisplay_busdisplay_set_refresh_buffer_size(self, refresh_buffer_size)) {
+        // The display is already registered and works with the default buffer, so don't raise.
+        #if CIRCUITPY_WARNINGS
+        warnings_warn(&mp_type_Warning, MP_ERROR_TEXT("Could not allocate DMA capable buffer"));
+        #endif
+    }
 
     return self;
 }
@@ -393,6 +405,20 @@ MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_bus_obj, busdisplay_busdispl
 MP_PROPERTY_GETTER(busdisplay_busdisplay_bus_obj,
     (mp_obj_t)&busdisplay_busdisplay_get_bus_obj);
 
+//|     refresh_stats: Tuple[int, int, int, int]
+//|     """Counts for the most recent refresh, as
+//|     ``(pixels_requested, pixels_refreshed, areas_requested, areas_refreshed)``.
+//|     Overlapping and nearby dirty areas are merged before they are sent, so
+//|     ``pixels_refreshed / pixels_requested`` is the overdraw. (read-only)"""
+static mp_obj_t busdisplay_busdisplay_obj_get_refresh_stats(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    return common_hal_busdisplay_busdisplay_get_refresh_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_refresh_stats_obj, busdisplay_busdisplay_obj_get_refresh_stats);
+
+MP_PROPERTY_GETTER(busdisplay_busdisplay_refresh_stats_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_refresh_stats_obj);
+
 //|     root_group: displayio.Group
 //|     """The root group on the display.
 //|     If the root group is set to `displayio.CIRCUITPYTHON_TERMINAL`, the default CircuitPython terminal will be shown.
@@ -495,6 +521,7 @@ static const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&busdisplay_busdisplay_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&busdisplay_busdisplay_rotation_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&busdisplay_busdisplay_bus_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_stats), MP_ROM_PTR(&busdisplay_busdisplay_refresh_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&busdisplay_busdisplay_root_group_obj) },
 };
 static MP_DEFINE_CONST_DICT(busdisplay_busdisplay_locals_dict, busdisplay_busdisplay_locals_dict_table);
@@ -26,6 +26,8 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
     bool single_byte_bounds, bool data_as_commands, bool auto_refresh, uint16_t native_frames_per_second,
     bool backlight_on_high, bool SH1107_addressing, uint16_t backlight_pwm_frequency);
 
+bool common_hal_busdisplay_busdisplay_set_refresh_buffer_size(busdisplay_busdisplay_obj_t *self, uint32_t refresh_buffer_size);
+
 bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame);
 
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self);
@@ -33,6 +35,7 @@ void common_hal_busdisplay_busdisplay_set_auto_refresh(busdisplay_busdisplay_obj
 
 uint16_t common_hal_busdisplay_busdisplay_get_width(busdisplay_busdisplay_obj_t *self);
 uint16_t common_hal_busdisplay_busdisplay_get_height(busdisplay_busdisplay_obj_t *self);
+mp_obj_t common_hal_busdisplay_busdisplay_get_refresh_stats(busdisplay_busdisplay_obj_t *self);
 uint16_t common_hal_busdisplay_busdisplay_get_rotation(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *self, int rotation);
 
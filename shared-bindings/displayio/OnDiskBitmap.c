@@ -47,10 +47,14 @@
 //|       while True:
 //|           pass"""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO]) -> None:
+//|     def __init__(self, file: Union[str, typing.BinaryIO], *, cached_rows: int = 1) -> None:
 //|         """Create an OnDiskBitmap object with the given file.
 //|
 //|         :param file file: The name of the bitmap file.  For backwards compatibility, a file opened in binary mode may also be passed.
+//|         :param int cached_rows: The number of rows of file data to keep in RAM. Rows are read
+//|           from the file whole and the least recently used row is replaced when a new one is needed.
+//|           Larger values speed up rotated displays at the cost of ``cached_rows`` times the row size
+//|           in RAM. 0 disables the cache and reads each pixel from the file.
 //|
 //|         Older versions of CircuitPython required a file opened in binary
 //|         mode. CircuitPython 7.0 modified OnDiskBitmap so that it takes a
@@ -60,8 +64,16 @@
 //|         ...
 //|
 static mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    mp_arg_check_num(n_args, n_kw, 1, 1, false);
-    mp_obj_t arg = all_args[0];
+    enum { ARG_file, ARG_cached_rows };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_cached_rows, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t arg = args[ARG_file].u_obj;
+    uint16_t cached_rows = mp_arg_validate_int_range(args[ARG_cached_rows].u_int, 0, 0xffff, MP_QSTR_cached_rows);
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
@@ -71,7 +83,7 @@ static mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_
     }
 
     displayio_ondiskbitmap_t *self = mp_obj_malloc(displayio_ondiskbitmap_t, &displayio_ondiskbitmap_type);
-    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg));
+    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg), cached_rows);
 
     return MP_OBJ_FROM_PTR(self);
 }
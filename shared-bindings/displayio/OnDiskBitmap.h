@@ -11,7 +11,7 @@
 
 extern const mp_obj_type_t displayio_ondiskbitmap_type;
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file);
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint16_t cached_rows);
 
 uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *bitmap,
     int16_t x, int16_t y);
@@ -389,6 +389,20 @@ MP_DEFINE_CONST_FUN_OBJ_1(epaperdisplay_epaperdisplay_get_bus_obj, epaperdisplay
 MP_PROPERTY_GETTER(epaperdisplay_epaperdisplay_bus_obj,
     (mp_obj_t)&epaperdisplay_epaperdisplay_get_bus_obj);
 
+//|     refresh_stats: Tuple[int, int, int, int]
+//|     """Counts for the most recent refresh, as
+//|     ``(pixels_requested, pixels_refreshed, areas_requested, areas_refreshed)``.
+//|     Overlapping and nearby dirty areas are merged before they are sent, so
+//|     ``pixels_refreshed / pixels_requested`` is the overdraw. (read-only)"""
+static mp_obj_t epaperdisplay_epaperdisplay_obj_get_refresh_stats(mp_obj_t self_in) {
+    epaperdisplay_epaperdisplay_obj_t *self = native_display(self_in);
+    return common_hal_epaperdisplay_epaperdisplay_get_refresh_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(epaperdisplay_epaperdisplay_get_refresh_stats_obj, epaperdisplay_epaperdisplay_obj_get_refresh_stats);
+
+MP_PROPERTY_GETTER(epaperdisplay_epaperdisplay_refresh_stats_obj,
+    (mp_obj_t)&epaperdisplay_epaperdisplay_get_refresh_stats_obj);
+
 //|     root_group: displayio.Group
 //|     """The root group on the epaper display.
 //|     If the root group is set to `displayio.CIRCUITPYTHON_TERMINAL`, the default CircuitPython terminal will be shown.
@@ -429,6 +443,7 @@ static const mp_rom_map_elem_t epaperdisplay_epaperdisplay_locals_dict_table[] =
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&epaperdisplay_epaperdisplay_bus_obj) },
     { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&epaperdisplay_epaperdisplay_busy_obj) },
     { MP_ROM_QSTR(MP_QSTR_time_to_refresh), MP_ROM_PTR(&epaperdisplay_epaperdisplay_time_to_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_stats), MP_ROM_PTR(&epaperdisplay_epaperdisplay_refresh_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&epaperdisplay_epaperdisplay_root_group_obj) },
 };
 static MP_DEFINE_CONST_DICT(epaperdisplay_epaperdisplay_locals_dict, epaperdisplay_epaperdisplay_locals_dict_table);
@@ -29,6 +29,7 @@ void common_hal_framebufferio_framebufferdisplay_set_auto_refresh(framebufferio_
 
 uint16_t common_hal_framebufferio_framebufferdisplay_get_width(framebufferio_framebufferdisplay_obj_t *self);
 uint16_t common_hal_framebufferio_framebufferdisplay_get_height(framebufferio_framebufferdisplay_obj_t *self);
+mp_obj_t common_hal_framebufferio_framebufferdisplay_get_refresh_stats(framebufferio_framebufferdisplay_obj_t *self);
 uint16_t common_hal_framebufferio_framebufferdisplay_get_rotation(framebufferio_framebufferdisplay_obj_t *self);
 void common_hal_framebufferio_framebufferdisplay_set_rotation(framebufferio_framebufferdisplay_obj_t *self, int rotation);
 
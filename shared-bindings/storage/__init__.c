@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "extmod/vfs_fat.h"
+#include "extmod/vfs_rom.h"
 #include "py/obj.h"
 #include "py/objnamedtuple.h"
 #include "py/runtime.h"
@@ -28,12 +29,12 @@
 //| """
 //|
 //|
-//| def mount(filesystem: VfsFat, mount_path: str, *, readonly: bool = False) -> None:
+//| def mount(filesystem: Union[VfsFat, VfsRom], mount_path: str, *, readonly: bool = False) -> None:
 //|     """Mounts the given filesystem object at the given path.
 //|
 //|     This is the CircuitPython analog to the UNIX ``mount`` command.
 //|
-//|     :param VfsFat filesystem: The filesystem to mount.
+//|     :param filesystem: The filesystem to mount. `VfsRom` is only available on some boards.
 //|     :param str mount_path: Where to mount the filesystem.
 //|     :param bool readonly: True when the filesystem should be readonly to CircuitPython.
 //|     """
@@ -57,8 +58,14 @@ static mp_obj_t storage_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 
     mp_obj_t vfs_obj = args[ARG_filesystem].u_obj;
 
-    // Currently, the only supported filesystem is VfsFat.
-    mp_arg_validate_type(vfs_obj, &mp_fat_vfs_type, MP_QSTR_filesystem);
+    // Currently, the only supported filesystems are VfsFat and VfsRom.
+    const mp_obj_type_t *vfs_type = &mp_fat_vfs_type;
+    #if CIRCUITPY_VFS_ROM
+    if (mp_obj_is_type(vfs_obj, &mp_type_vfs_rom)) {
+        vfs_type = &mp_type_vfs_rom;
+    }
+    #endif
+    mp_arg_validate_type(vfs_obj, vfs_type, MP_QSTR_filesystem);
 
     common_hal_storage_mount(vfs_obj, mnt_str, args[ARG_readonly].u_bool);
 
@@ -306,6 +313,60 @@ static const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|
 //|
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
+
+//| class VfsRom:
+//|     def __init__(self, image: ReadableBuffer) -> None:
+//|         """Create a read-only filesystem from a ROMFS image in memory, usually
+//|         flash that is memory mapped. The image is used in place, not copied.
+//|
+//|         Modules imported from a `VfsRom` run in place too: their bytecode, names
+//|         and string constants are used from the image, so they take much less RAM
+//|         than the same modules imported from a `VfsFat`.
+//|
+//|         Only available on boards built with ``CIRCUITPY_VFS_ROM``.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer image: The ROMFS image. It must not
+//|           change while the filesystem is mounted.
+//|
+//|         Mounting an image kept in flash as a bytes constant of a frozen module::
+//|
+//|           import storage
+//|           import sys
+//|           from romfs_image import IMAGE
+//|
+//|           storage.mount(storage.VfsRom(IMAGE), "/rom")
+//|           sys.path.insert(0, "/rom/lib")
+//|         """
+//|
+//|     def open(self, path: str, mode: str) -> None:
+//|         """Like builtin ``open()``. Only reading is supported."""
+//|         ...
+//|
+//|     def ilistdir(self, path: str) -> Iterator[Tuple[AnyStr, int, int, int]]:
+//|         """Return an iterator whose values describe files and folders within
+//|         ``path``"""
+//|         ...
+//|
+//|     def stat(self, path: str) -> Tuple[int, int, int, int, int, int, int, int, int, int]:
+//|         """Like `os.stat`"""
+//|         ...
+//|
+//|     def statvfs(self, path: int) -> Tuple[int, int, int, int, int, int, int, int, int, int]:
+//|         """Like `os.statvfs`"""
+//|         ...
+//|
+//|     def mount(self, readonly: bool, mkfs: bool) -> None:
+//|         """Don't call this directly, call `storage.mount`."""
+//|         ...
+//|
+//|     def umount(self) -> None:
+//|         """Don't call this directly, call `storage.umount`."""
+//|         ...
+//|
+//|
+    #if CIRCUITPY_VFS_ROM
+    { MP_ROM_QSTR(MP_QSTR_VfsRom), MP_ROM_PTR(&mp_type_vfs_rom) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(storage_module_globals, storage_module_globals_table);
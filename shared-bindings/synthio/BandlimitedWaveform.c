@@ -0,0 +1,93 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/BandlimitedWaveform.h"
+#include "shared-module/synthio/__init__.h"
+#include "shared-module/synthio/BandlimitedWaveform.h"
+
+//| class BandlimitedWaveform:
+//|     """A single-cycle waveform that is free of aliasing at any pitch
+//|
+//|     A plain waveform played at a high pitch produces aliasing, because its
+//|     harmonics above half the sample rate fold back down into the audible
+//|     range as inharmonic tones. A `BandlimitedWaveform` computes a chain of
+//|     successively low-pass filtered, half-length copies of `waveform` once when
+//|     it is constructed. During playback, the copy whose harmonics all fit below
+//|     half the sample rate is chosen according to the note's frequency, and it is
+//|     linearly interpolated between samples.
+//|
+//|     A `BandlimitedWaveform` can be used anywhere a waveform is accepted, such
+//|     as `Note.waveform`, `Note.ring_waveform` and `Synthesizer`'s ``waveform``.
+//|     Its buffer is read-only and has the contents of the original waveform.
+//|
+//|     The number of levels depends on how many times the length of `waveform`
+//|     can be halved, so lengths that are a power of two work best.
+//|
+//|     The copies take about as much memory as the original waveform."""
+//|
+//|     def __init__(self, waveform: ReadableBuffer) -> None:
+//|         """Create a band-limited waveform
+//|
+//|         :param ReadableBuffer waveform: A single-cycle waveform. Must be a ReadableBuffer of type 'h' (signed 16 bit)"""
+//|         ...
+//|
+static mp_obj_t synthio_bandlimited_waveform_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_waveform };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    synthio_synth_parse_waveform(&bufinfo, args[ARG_waveform].u_obj);
+
+    synthio_bandlimited_waveform_obj_t *self = mp_obj_malloc(synthio_bandlimited_waveform_obj_t, &synthio_bandlimited_waveform_type);
+    common_hal_synthio_bandlimited_waveform_construct(self, &bufinfo);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     levels: int
+//|     """The number of band-limited copies of the waveform, including the original (read-only)"""
+//|
+static mp_obj_t synthio_bandlimited_waveform_get_levels(mp_obj_t self_in) {
+    synthio_bandlimited_waveform_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_bandlimited_waveform_get_levels(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_bandlimited_waveform_get_levels_obj, synthio_bandlimited_waveform_get_levels);
+
+MP_PROPERTY_GETTER(synthio_bandlimited_waveform_levels_obj,
+    (mp_obj_t)&synthio_bandlimited_waveform_get_levels_obj);
+
+static mp_int_t synthio_bandlimited_waveform_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    synthio_bandlimited_waveform_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // The filtered copies are not recomputed, so the buffer may not be changed
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    bufinfo->buf = self->data;
+    bufinfo->len = self->length * sizeof(int16_t);
+    bufinfo->typecode = 'h';
+    return 0;
+}
+
+static const mp_rom_map_elem_t synthio_bandlimited_waveform_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_levels), MP_ROM_PTR(&synthio_bandlimited_waveform_levels_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_bandlimited_waveform_locals_dict, synthio_bandlimited_waveform_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_bandlimited_waveform_type,
+    MP_QSTR_BandlimitedWaveform,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_bandlimited_waveform_make_new,
+    locals_dict, &synthio_bandlimited_waveform_locals_dict,
+    buffer, synthio_bandlimited_waveform_get_buffer
+    );
@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct synthio_bandlimited_waveform_obj synthio_bandlimited_waveform_obj_t;
+extern const mp_obj_type_t synthio_bandlimited_waveform_type;
+
+void common_hal_synthio_bandlimited_waveform_construct(synthio_bandlimited_waveform_obj_t *self, const mp_buffer_info_t *bufinfo);
+mp_int_t common_hal_synthio_bandlimited_waveform_get_levels(synthio_bandlimited_waveform_obj_t *self);
@@ -138,6 +138,10 @@ MP_PROPERTY_GETSET(synthio_note_panning_obj,
 //|     An amplitude of 0 makes the note inaudible. It is combined multiplicatively with
 //|     the value from the note's envelope.
 //|
+//|     The combined loudness, including `panning`, is updated once per block of
+//|     samples and ramps linearly within each block, so changes don't cause
+//|     audible steps.
+//|
 //|     To achieve a tremolo effect, attach an LFO here."""
 static mp_obj_t synthio_note_get_amplitude(mp_obj_t self_in) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -0,0 +1,217 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#if CIRCUITPY_AUDIOCORE_BUFFEREDSAMPLE
+
+#include "shared-bindings/audiocore/BufferedSample.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-module/audiocore/BufferedSample.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#if defined(MICROPY_UNIX_COVERAGE)
+#define background_callback_prevent() ((void)0)
+#define background_callback_allow() ((void)0)
+#define background_callback_add(buf, fn, arg) ((fn)((arg)))
+#endif
+
+// The producer's writes to the ring must be visible before the count that
+// publishes them, and likewise the consumer must be done with a chunk before
+// the count that releases it.
+#define LOAD_SHARED(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_SHARED(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+// Chunks handed out are whole words, so they are whole frames in every format
+#define CHUNK_ALIGN (4)
+
+void common_hal_audioio_bufferedsample_construct(audioio_bufferedsample_obj_t *self,
+    mp_obj_t sample, mp_float_t lead_time) {
+    audiosample_base_t *source = audiosample_check(sample);
+    audiosample_check_for_deinit(source);
+
+    self->sample = sample;
+    self->lead_time = lead_time;
+    self->base.sample_rate = source->sample_rate;
+    self->base.channel_count = source->channel_count;
+    self->base.bits_per_sample = source->bits_per_sample;
+    self->base.samples_signed = source->samples_signed;
+    self->base.single_buffer = false;
+
+    uint32_t bytes_per_frame = source->channel_count * source->bits_per_sample / 8;
+    uint32_t lead_bytes = (uint32_t)(lead_time * source->sample_rate) * bytes_per_frame;
+    uint32_t chunk = MAX(source->max_buffer_length & ~(CHUNK_ALIGN - 1), CHUNK_ALIGN);
+
+    self->ring_size = CHUNK_ALIGN;
+    while (self->ring_size < lead_bytes || self->ring_size < 2 * chunk) {
+        self->ring_size *= 2;
+    }
+    self->base.max_buffer_length = MIN(chunk, self->ring_size / 2);
+
+    // The ring and the silence have no pointers, so they don't need to be scanned by the gc
+    self->ring = m_malloc_without_collect(self->ring_size);
+    self->silence = m_malloc_without_collect(self->base.max_buffer_length);
+    if (self->base.samples_signed) {
+        memset(self->silence, 0, self->base.max_buffer_length);
+    } else if (self->base.bits_per_sample == 8) {
+        memset(self->silence, 0x80, self->base.max_buffer_length);
+    } else {
+        uint16_t *silence16 = (uint16_t *)(void *)self->silence;
+        for (uint32_t i = 0; i < self->base.max_buffer_length / 2; i++) {
+            silence16[i] = 0x8000;
+        }
+    }
+
+    // Nothing is available until the first reset_buffer, which is when a
+    // sample is first allowed to produce data.
+    self->finished = true;
+    self->sample_result = GET_BUFFER_DONE;
+}
+
+void common_hal_audioio_bufferedsample_deinit(audioio_bufferedsample_obj_t *self) {
+    self->ring = NULL;
+    self->silence = NULL;
+    self->sample = MP_OBJ_NULL;
+    audiosample_mark_deinit(&self->base);
+}
+
+mp_float_t common_hal_audioio_bufferedsample_get_lead_time(audioio_bufferedsample_obj_t *self) {
+    return self->lead_time;
+}
+
+uint32_t common_hal_audioio_bufferedsample_get_underruns(audioio_bufferedsample_obj_t *self) {
+    return self->underruns;
+}
+
+// Copy as much from the wrapped sample into the ring as fits
+static void bufferedsample_fill(audioio_bufferedsample_obj_t *self) {
+    uint32_t mask = self->ring_size - 1;
+    while (!self->finished) {
+        uint32_t space = self->ring_size - (self->write_count - LOAD_SHARED(&self->read_count));
+        if (space == 0) {
+            break;
+        }
+
+        if (self->sample_buffer_remaining == 0) {
+            if (self->sample_result == GET_BUFFER_MORE_DATA) {
+                self->sample_result = audiosample_get_buffer(self->sample, false, 0,
+                    &self->sample_buffer, &self->sample_buffer_remaining);
+                if (self->sample_result == GET_BUFFER_ERROR) {
+                    self->sample_buffer_remaining = 0;
+                } else if (self->sample_result == GET_BUFFER_MORE_DATA && self->sample_buffer_remaining == 0) {
+                    // try again later
+                    break;
+                }
+                continue;
+            }
+
+            // The wrapped sample is done. Pad it with silence to a whole
+            // chunk, which never crosses the end of the ring.
+            uint32_t pad = -self->write_count & (CHUNK_ALIGN - 1);
+            if (pad > space) {
+                break;
+            }
+            memcpy(self->ring + (self->write_count & mask), self->silence, pad);
+            STORE_SHARED(&self->write_count, self->write_count + pad);
+            STORE_SHARED(&self->finished, true);
+            break;
+        }
+
+        uint32_t n = MIN(space, self->sample_buffer_remaining);
+        n = MIN(n, self->ring_size - (self->write_count & mask));
+        memcpy(self->ring + (self->write_count & mask), self->sample_buffer, n);
+        self->sample_buffer += n;
+        self->sample_buffer_remaining -= n;
+        STORE_SHARED(&self->write_count, self->write_count + n);
+    }
+}
+
+static void bufferedsample_fill_cb(void *self_in) {
+    audioio_bufferedsample_obj_t *self = self_in;
+    if (audiosample_deinited(&self->base)) {
+        return;
+    }
+    bufferedsample_fill(self);
+}
+
+void audioio_bufferedsample_reset_buffer(audioio_bufferedsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    // Playback is stopped or looping, so the consumer is idle; keep the
+    // producer from running while its state is reset.
+    background_callback_prevent();
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->write_count = 0;
+    self->read_count = 0;
+    self->pending = 0;
+    self->sample_buffer_remaining = 0;
+    self->sample_result = GET_BUFFER_MORE_DATA;
+    self->finished = false;
+    // Fill all of the lead time now, so playback doesn't start with an underrun
+    bufferedsample_fill(self);
+    background_callback_allow();
+}
+
+audioio_get_buffer_result_t audioio_bufferedsample_get_buffer(audioio_bufferedsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    if (single_channel_output && channel == 1) {
+        *buffer = self->last_buffer + self->base.bits_per_sample / 8;
+        *buffer_length = self->last_buffer_length;
+        return self->last_result;
+    }
+
+    // The chunk handed out last time is no longer in use, so the producer can
+    // overwrite it.
+    uint32_t read_count = self->read_count + self->pending;
+    STORE_SHARED(&self->read_count, read_count);
+    self->pending = 0;
+
+    // Check for the end before the count, so all of the final data is counted
+    bool finished = LOAD_SHARED(&self->finished);
+    uint32_t available = LOAD_SHARED(&self->write_count) - read_count;
+    audioio_get_buffer_result_t end_result =
+        self->sample_result == GET_BUFFER_ERROR ? GET_BUFFER_ERROR : GET_BUFFER_DONE;
+
+    uint32_t chunk = MIN(available & ~(CHUNK_ALIGN - 1), self->base.max_buffer_length);
+    chunk = MIN(chunk, self->ring_size - (read_count & (self->ring_size - 1)));
+
+    if (chunk != 0) {
+        *buffer = self->ring + (read_count & (self->ring_size - 1));
+        *buffer_length = chunk;
+        self->pending = chunk;
+        self->last_result = (finished && chunk == available) ? end_result : GET_BUFFER_MORE_DATA;
+    } else if (finished) {
+        *buffer = self->silence;
+        *buffer_length = 0;
+        self->last_result = end_result;
+    } else {
+        // The producer fell behind. Play silence rather than stopping.
+        *buffer = self->silence;
+        *buffer_length = self->base.max_buffer_length;
+        self->underruns += 1;
+        audiosample_record_underrun(MP_OBJ_FROM_PTR(self));
+        self->last_result = GET_BUFFER_MORE_DATA;
+    }
+    self->last_buffer = *buffer;
+    self->last_buffer_length = *buffer_length;
+
+    if (!finished) {
+        background_callback_add(&self->fill_cb, bufferedsample_fill_cb, self);
+    }
+
+    return self->last_result;
+}
+
+#endif
@@ -0,0 +1,52 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "supervisor/background_callback.h"
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// The ring is a single-producer, single-consumer queue. The producer is the
+// background callback that reads from the wrapped sample, and the consumer is
+// get_buffer, which may be called from an interrupt. Each side only writes its
+// own count, so no lock is needed. The counts increase without bound (mod 2^32)
+// and are masked to find a position in the ring, whose size is a power of two.
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t sample;
+    background_callback_t fill_cb;
+    uint8_t *ring;
+    uint8_t *silence;
+    uint32_t ring_size;
+    mp_float_t lead_time;
+
+    // Only written by the producer
+    uint32_t write_count;
+    uint8_t *sample_buffer;
+    uint32_t sample_buffer_remaining;
+    audioio_get_buffer_result_t sample_result;
+    bool finished;
+
+    // Only written by the consumer
+    uint32_t read_count;
+    uint32_t pending;
+    audioio_get_buffer_result_t last_result;
+    uint8_t *last_buffer;
+    uint32_t last_buffer_length;
+    uint32_t underruns;
+} audioio_bufferedsample_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_bufferedsample_reset_buffer(audioio_bufferedsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioio_bufferedsample_get_buffer(audioio_bufferedsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                     // length in bytes
@@ -0,0 +1,323 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#if CIRCUITPY_AUDIOCORE_RESAMPLER
+
+#include "shared-bindings/audiocore/Resampler.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-bindings/audiocore/__init__.h"
+
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// Frames of input converted at a time, beyond the filter's own taps
+#define INPUT_BLOCK (256)
+// Coefficients are Q14, so that the unity tap fits in an int16_t and a sample
+// at an integer phase passes through unchanged. No tap is near +/-2.
+#define COEFFICIENT_SHIFT (14)
+
+static const struct {
+    uint8_t taps;
+    uint8_t phase_shift; // the number of phases is 1 << (32 - phase_shift)
+} quality_presets[] = {
+    [RESAMPLER_QUALITY_LOW] = { 2, 24 },
+    [RESAMPLER_QUALITY_MEDIUM] = { 8, 26 },
+    [RESAMPLER_QUALITY_HIGH] = { 16, 25 },
+};
+
+// Fill in the filter's coefficients, one row of taps per phase. LOW is linear
+// interpolation. The others are Blackman windowed sincs, with the cutoff lowered
+// when downsampling so the output doesn't alias. Each phase is scaled so its taps
+// add up to 1 and DC is passed unchanged.
+static void resampler_coefficients(audioio_resampler_obj_t *self, uint32_t input_rate) {
+    uint32_t phases = 1u << (32 - self->phase_shift);
+    int taps = self->taps;
+    mp_float_t cutoff = MIN(MICROPY_FLOAT_CONST(1.0), (mp_float_t)self->base.sample_rate / input_rate);
+    mp_float_t half_width = taps / 2;
+    mp_float_t h[16];
+    for (uint32_t p = 0; p < phases; p++) {
+        mp_float_t offset = (mp_float_t)p / phases;
+        mp_float_t sum = 0;
+        for (int j = 0; j < taps; j++) {
+            // The distance from the output's position to tap j
+            mp_float_t x = j - (taps / 2 - 1) - offset;
+            if (self->quality == RESAMPLER_QUALITY_LOW) {
+                h[j] = 1 - MICROPY_FLOAT_C_FUN(fabs)(x);
+            } else {
+                mp_float_t window = MICROPY_FLOAT_CONST(0.42)
+                    + MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(MP_PI * x / half_width)
+                    + MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(2 * MP_PI * x / half_width);
+                mp_float_t t = MP_PI * cutoff * x;
+                h[j] = (t == 0 ? 1 : MICROPY_FLOAT_C_FUN(sin)(t) / t) * window;
+            }
+            sum += h[j];
+        }
+        for (int j = 0; j < taps; j++) {
+            self->coefficients[p * taps + j] = (int16_t)MICROPY_FLOAT_C_FUN(round)(h[j] / sum * (1 << COEFFICIENT_SHIFT));
+        }
+    }
+}
+
+void common_hal_audioio_resampler_construct(audioio_resampler_obj_t *self,
+    mp_obj_t sample, uint32_t sample_rate, audioio_resampler_quality_t quality,
+    uint32_t buffer_size) {
+    audiosample_base_t *source = audiosample_check(sample);
+    audiosample_check_for_deinit(source);
+
+    self->sample = sample;
+    self->quality = quality;
+    self->base.sample_rate = sample_rate;
+    self->base.channel_count = source->channel_count;
+    self->base.bits_per_sample = source->bits_per_sample;
+    self->base.samples_signed = source->samples_signed;
+    self->base.single_buffer = false;
+
+    // The position advances by the ratio of the rates for each output frame, as
+    // a whole number of frames and a 32 bit fraction.
+    uint64_t step = ((uint64_t)source->sample_rate << 32) / sample_rate;
+    self->step_whole = step >> 32;
+    self->step_fraction = (uint32_t)step;
+
+    self->taps = quality_presets[quality].taps;
+    self->phase_shift = quality_presets[quality].phase_shift;
+    // None of these buffers have pointers, so they don't need to be scanned by the gc
+    self->coefficients = m_malloc_without_collect((1u << (32 - self->phase_shift)) * self->taps * sizeof(int16_t));
+    resampler_coefficients(self, source->sample_rate);
+
+    self->input_capacity = self->taps + INPUT_BLOCK;
+    self->input = m_malloc_without_collect(self->input_capacity * self->base.channel_count * sizeof(int16_t));
+
+    // Output is filtered as 16 bit samples, and 8 bit samples are packed in place
+    uint32_t bytes_per_frame = self->base.channel_count * self->base.bits_per_sample / 8;
+    self->buffer_len = MAX(buffer_size / bytes_per_frame, 1) * bytes_per_frame;
+    self->base.max_buffer_length = self->buffer_len;
+    uint32_t allocation = self->buffer_len * 16 / self->base.bits_per_sample;
+    self->buffer[0] = m_malloc_without_collect(allocation);
+    self->buffer[1] = m_malloc_without_collect(allocation);
+    self->last_buf_idx = 1;
+
+    // Nothing is available until the first reset_buffer, which is when a
+    // sample is first allowed to produce data.
+    self->sample_result = GET_BUFFER_DONE;
+    self->last_result = GET_BUFFER_DONE;
+}
+
+void common_hal_audioio_resampler_deinit(audioio_resampler_obj_t *self) {
+    self->coefficients = NULL;
+    self->input = NULL;
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->sample = MP_OBJ_NULL;
+    audiosample_mark_deinit(&self->base);
+}
+
+audioio_resampler_quality_t common_hal_audioio_resampler_get_quality(audioio_resampler_obj_t *self) {
+    return self->quality;
+}
+
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->sample_buffer_remaining = 0;
+    self->sample_result = GET_BUFFER_MORE_DATA;
+
+    // The filter is centred between taps / 2 - 1 and taps / 2, so that many
+    // frames of silence go before the sample, and taps / 2 go after it.
+    self->input_count = self->taps / 2 - 1;
+    memset(self->input, 0, self->input_count * self->base.channel_count * sizeof(int16_t));
+    self->input_skip = 0;
+    self->flush_remaining = self->taps / 2;
+    self->position = 0;
+    self->fraction = 0;
+}
+
+// Convert n frames from the wrapped sample to 16 bit signed, at the end of the input
+static void resampler_convert(audioio_resampler_obj_t *self, uint32_t n) {
+    int16_t *dst = self->input + self->input_count * self->base.channel_count;
+    uint32_t count = n * self->base.channel_count;
+    if (self->base.bits_per_sample == 16) {
+        const int16_t *src = (const int16_t *)(const void *)self->sample_buffer;
+        int16_t flip = self->base.samples_signed ? 0 : 0x8000;
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = src[i] ^ flip;
+        }
+    } else {
+        const int8_t *src = (const int8_t *)self->sample_buffer;
+        int8_t flip = self->base.samples_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = (int8_t)(src[i] ^ flip) * 256;
+        }
+    }
+}
+
+// Drop the input frames that are no longer needed and read more from the
+// wrapped sample. Returns false when no more frames could be read.
+static bool resampler_fill(audioio_resampler_obj_t *self) {
+    uint8_t channel_count = self->base.channel_count;
+    uint32_t bytes_per_frame = channel_count * self->base.bits_per_sample / 8;
+
+    // When downsampling, the position may be beyond the frames read so far
+    if (self->position < self->input_count) {
+        memmove(self->input, self->input + self->position * channel_count,
+            (self->input_count - self->position) * channel_count * sizeof(int16_t));
+        self->input_count -= self->position;
+    } else {
+        self->input_skip += self->position - self->input_count;
+        self->input_count = 0;
+    }
+    self->position = 0;
+
+    uint32_t start = self->input_count;
+    while (self->input_count < self->input_capacity) {
+        uint32_t space = self->input_capacity - self->input_count;
+        if (self->sample_buffer_remaining < bytes_per_frame) {
+            if (self->sample_result == GET_BUFFER_MORE_DATA) {
+                self->sample_result = audiosample_get_buffer(self->sample, false, 0,
+                    &self->sample_buffer, &self->sample_buffer_remaining);
+                if (self->sample_result == GET_BUFFER_ERROR) {
+                    self->sample_buffer_remaining = 0;
+                } else if (self->sample_result == GET_BUFFER_MORE_DATA && self->sample_buffer_remaining == 0) {
+                    // try again later
+                    break;
+                }
+                continue;
+            }
+
+            // The wrapped sample is done. Pad it with silence, so its last
+            // frames reach the centre of the filter.
+            uint32_t skip = MIN(self->input_skip, self->flush_remaining);
+            self->input_skip -= skip;
+            self->flush_remaining -= skip;
+            uint32_t n = MIN(self->flush_remaining, space);
+            if (n == 0) {
+                break;
+            }
+            memset(self->input + self->input_count * channel_count, 0, n * channel_count * sizeof(int16_t));
+            self->input_count += n;
+            self->flush_remaining -= n;
+            continue;
+        }
+
+        uint32_t frames = self->sample_buffer_remaining / bytes_per_frame;
+        uint32_t n;
+        if (self->input_skip != 0) {
+            n = MIN(frames, self->input_skip);
+            self->input_skip -= n;
+        } else {
+            n = MIN(frames, space);
+            resampler_convert(self, n);
+            self->input_count += n;
+        }
+        self->sample_buffer += n * bytes_per_frame;
+        self->sample_buffer_remaining -= n * bytes_per_frame;
+    }
+    return self->input_count > start;
+}
+
+static inline int16_t resampler_sat16(int32_t val) {
+    return MIN(MAX(val, INT16_MIN), INT16_MAX);
+}
+
+// Filter up to max_frames output frames from the input that has been read.
+// channel_count is a constant where this is inlined, so the inner loop is
+// specialized for mono and stereo.
+static inline MP_ALWAYSINLINE uint32_t resampler_filter(audioio_resampler_obj_t *self,
+    int16_t *out, uint32_t max_frames, uint8_t channel_count) {
+    const int16_t *coefficients = self->coefficients;
+    uint32_t taps = self->taps;
+    uint8_t phase_shift = self->phase_shift;
+    uint32_t position = self->position;
+    uint32_t fraction = self->fraction;
+    uint32_t n = 0;
+    while (n < max_frames && position + taps <= self->input_count) {
+        const int16_t *c = coefficients + (fraction >> phase_shift) * taps;
+        const int16_t *in = self->input + position * channel_count;
+        for (uint8_t ch = 0; ch < channel_count; ch++) {
+            int32_t acc = 1 << (COEFFICIENT_SHIFT - 1);
+            for (uint32_t j = 0; j < taps; j++) {
+                acc += in[j * channel_count + ch] * c[j];
+            }
+            out[n * channel_count + ch] = resampler_sat16(acc >> COEFFICIENT_SHIFT);
+        }
+        uint32_t next = fraction + self->step_fraction;
+        position += self->step_whole + (next < fraction);
+        fraction = next;
+        n++;
+    }
+    self->position = position;
+    self->fraction = fraction;
+    return n;
+}
+
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
+    if (single_channel_output && channel == 1) {
+        *buffer = self->buffer[self->last_buf_idx] + bytes_per_sample;
+        *buffer_length = self->last_buffer_length;
+        return self->last_result;
+    }
+
+    self->last_buf_idx = !self->last_buf_idx;
+    uint8_t channel_count = self->base.channel_count;
+    int16_t *out = (int16_t *)(void *)self->buffer[self->last_buf_idx];
+    uint32_t max_frames = self->buffer_len / (channel_count * bytes_per_sample);
+    uint32_t frames = 0;
+    while (frames < max_frames) {
+        uint32_t n;
+        if (channel_count == 1) {
+            n = resampler_filter(self, out + frames, max_frames - frames, 1);
+        } else if (channel_count == 2) {
+            n = resampler_filter(self, out + frames * 2, max_frames - frames, 2);
+        } else {
+            n = resampler_filter(self, out + frames * channel_count, max_frames - frames, channel_count);
+        }
+        frames += n;
+        if (frames < max_frames && !resampler_fill(self)) {
+            break;
+        }
+    }
+
+    // Convert the filtered samples to the output format in place
+    uint32_t count = frames * channel_count;
+    if (bytes_per_sample == 2) {
+        if (!self->base.samples_signed) {
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] ^= 0x8000;
+            }
+        }
+    } else {
+        int8_t *out8 = (int8_t *)out;
+        int8_t flip = self->base.samples_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < count; i++) {
+            out8[i] = (int8_t)(out[i] >> 8) ^ flip;
+        }
+    }
+
+    *buffer = self->buffer[self->last_buf_idx];
+    *buffer_length = count * bytes_per_sample;
+    if (frames < max_frames && self->sample_result != GET_BUFFER_MORE_DATA) {
+        self->last_result = self->sample_result == GET_BUFFER_ERROR ? GET_BUFFER_ERROR : GET_BUFFER_DONE;
+    } else {
+        self->last_result = GET_BUFFER_MORE_DATA;
+    }
+    self->last_buffer_length = *buffer_length;
+    return self->last_result;
+}
+
+#endif
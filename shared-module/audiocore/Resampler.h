@@ -0,0 +1,60 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef enum {
+    RESAMPLER_QUALITY_LOW,
+    RESAMPLER_QUALITY_MEDIUM,
+    RESAMPLER_QUALITY_HIGH,
+} audioio_resampler_quality_t;
+
+// Each output frame is a dot product of `taps` input frames with one phase of a
+// polyphase filter. The position in the input is a whole frame index plus a
+// 32 bit fraction, whose top bits pick the phase.
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t sample;
+    audioio_resampler_quality_t quality;
+    uint8_t taps;
+    uint8_t phase_shift;
+    int16_t *coefficients;
+
+    // Input frames, converted to 16 bit signed
+    int16_t *input;
+    uint32_t input_capacity;
+    uint32_t input_count;
+    uint32_t input_skip;
+    uint32_t position;
+    uint32_t fraction;
+    uint32_t step_whole;
+    uint32_t step_fraction;
+    uint32_t flush_remaining;
+
+    uint8_t *sample_buffer;
+    uint32_t sample_buffer_remaining;
+    audioio_get_buffer_result_t sample_result;
+
+    uint8_t *buffer[2];
+    uint32_t buffer_len;
+    uint8_t last_buf_idx;
+    uint32_t last_buffer_length;
+    audioio_get_buffer_result_t last_result;
+} audioio_resampler_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                     // length in bytes
@@ -14,6 +14,16 @@
 
 #include "shared-module/audiocore/WaveFile.h"
 #include "shared-bindings/audiocore/__init__.h"
+#include "supervisor/port_heap.h"
+
+#if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING && defined(MICROPY_UNIX_COVERAGE)
+#define background_callback_add(buf, fn, arg) ((fn)((arg)))
+#define port_malloc(size, dma_capable) m_malloc_without_collect(size)
+#define port_free(ptr) ((void)(ptr))
+#endif
+
+// The most silence played at once while waiting for a chunk to be read
+#define WAVEFILE_SILENCE_LENGTH (256)
 
 struct wave_format_chunk {
     uint16_t audio_format;
@@ -32,7 +42,8 @@ struct wave_format_chunk {
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint32_t chunk_size) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -111,6 +122,29 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = chunk_length;
     self->data_start = self->file->fp.fptr;
 
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+    if (chunk_size) {
+        // These are outside the VM heap, so they can be used for DMA on every port
+        self->chunk_size = chunk_size;
+        self->base.max_buffer_length = chunk_size;
+        for (size_t i = 0; i < MP_ARRAY_SIZE(self->chunk); i++) {
+            self->chunk[i] = port_malloc(chunk_size, true);
+            if (self->chunk[i] == NULL) {
+                common_hal_audioio_wavefile_deinit(self);
+                m_malloc_fail(chunk_size);
+            }
+        }
+        self->silence_length = MIN(chunk_size, WAVEFILE_SILENCE_LENGTH);
+        self->silence = port_malloc(self->silence_length, true);
+        if (self->silence == NULL) {
+            common_hal_audioio_wavefile_deinit(self);
+            m_malloc_fail(self->silence_length);
+        }
+        memset(self->silence, self->base.bits_per_sample == 8 ? 0x80 : 0, self->silence_length);
+        return;
+    }
+    #endif
+
     // Try to allocate two buffers, one will be loaded from file and the other
     // DMAed to DAC.
     if (buffer_size) {
@@ -136,9 +170,180 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
     self->buffer = NULL;
     self->second_buffer = NULL;
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+    for (size_t i = 0; i < MP_ARRAY_SIZE(self->chunk); i++) {
+        port_free(self->chunk[i]);
+        self->chunk[i] = NULL;
+    }
+    port_free(self->silence);
+    self->silence = NULL;
+    self->chunk_size = 0;
+    #endif
     audiosample_mark_deinit(&self->base);
 }
 
+#if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+// A chunk must be read before the count that publishes it, and a rewind must
+// be done before it is marked done.
+#define LOAD_SHARED(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_SHARED(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+// Pad the last chunk to word align it. Chunks are whole words long, so there's room.
+static uint32_t wavefile_pad(audioio_wavefile_obj_t *self, uint8_t *buffer, uint32_t length) {
+    uint32_t pad = -length % sizeof(uint32_t);
+    if (pad == 0) {
+        return length;
+    }
+    if (self->base.bits_per_sample == 8) {
+        memset(buffer + length, 0x80, pad);
+    } else {
+        memset(buffer + length, 0, pad);
+    }
+    return length + pad;
+}
+
+// Read the next part of the file into chunk n. The first read ends on a
+// multiple of chunk_size in the file, so that later reads are whole, aligned
+// sectors, which FatFs transfers straight into the chunk without copying them
+// through its own sector buffer. A chunk_size that is a multiple of the
+// cluster size also keeps each read within as few clusters as possible.
+static bool wavefile_read_chunk(audioio_wavefile_obj_t *self, uint32_t n) {
+    uint8_t index = n % MP_ARRAY_SIZE(self->chunk);
+    uint32_t length = self->chunk_size;
+    uint32_t misalignment = f_tell(&self->file->fp) % self->chunk_size;
+    if (misalignment % sizeof(uint32_t) == 0) {
+        length -= misalignment;
+    }
+    length = MIN(length, self->bytes_remaining);
+    UINT length_read;
+    if (f_read(&self->file->fp, self->chunk[index], length, &length_read) != FR_OK || length_read != length) {
+        return false;
+    }
+    uint32_t bytes_remaining = self->bytes_remaining - length;
+    if (bytes_remaining == 0) {
+        length = wavefile_pad(self, self->chunk[index], length);
+    }
+    self->chunk_length[index] = length;
+    // get_buffer checks for the end before the count, so publish them in the
+    // other order, or it could see the end and miss the last chunk.
+    STORE_SHARED(&self->chunks_read, n + 1);
+    STORE_SHARED(&self->bytes_remaining, bytes_remaining);
+    return true;
+}
+
+// Take the file. This fails when get_buffer has interrupted the read ahead
+// while it has the file, since the read ahead can't go on until it returns.
+static bool wavefile_claim(audioio_wavefile_obj_t *self) {
+    return !__atomic_test_and_set(&self->reading, __ATOMIC_ACQUIRE);
+}
+
+static void wavefile_release(audioio_wavefile_obj_t *self) {
+    __atomic_clear(&self->reading, __ATOMIC_RELEASE);
+}
+
+// With the file claimed, rewind it if a reset asked to, and then read the
+// next chunk to play if it hasn't been read yet. Rewinding drops any chunk
+// read ahead before the reset.
+static bool wavefile_read_ahead(audioio_wavefile_obj_t *self) {
+    uint32_t rewinds_requested = LOAD_SHARED(&self->rewinds_requested);
+    uint32_t chunks_played = LOAD_SHARED(&self->chunks_played);
+    if (self->rewinds_done != rewinds_requested) {
+        if (f_lseek(&self->file->fp, self->data_start) != FR_OK) {
+            return false;
+        }
+        STORE_SHARED(&self->chunks_read, chunks_played);
+        STORE_SHARED(&self->bytes_remaining, self->file_length);
+        STORE_SHARED(&self->rewinds_done, rewinds_requested);
+    }
+    if (self->bytes_remaining == 0 || self->chunks_read != chunks_played) {
+        return true;
+    }
+    return wavefile_read_chunk(self, chunks_played);
+}
+
+static void wavefile_prefetch_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (audiosample_deinited(&self->base)) {
+        return;
+    }
+    // If a read fails, get_buffer will try again and report the error. A
+    // reset made while the file was held is done before returning.
+    while (wavefile_claim(self)) {
+        bool ok = wavefile_read_ahead(self);
+        wavefile_release(self);
+        if (!ok || LOAD_SHARED(&self->rewinds_requested) == self->rewinds_done) {
+            return;
+        }
+    }
+}
+
+// Whether chunk n has been read since the last reset
+static bool wavefile_chunk_ready(audioio_wavefile_obj_t *self, uint32_t n) {
+    return LOAD_SHARED(&self->rewinds_done) == self->rewinds_requested &&
+           LOAD_SHARED(&self->chunks_read) != n;
+}
+
+static audioio_get_buffer_result_t wavefile_stream_result(audioio_wavefile_obj_t *self) {
+    bool more = LOAD_SHARED(&self->rewinds_done) != self->rewinds_requested ||
+        LOAD_SHARED(&self->bytes_remaining) != 0 ||
+        LOAD_SHARED(&self->chunks_read) != self->chunks_played;
+    return more ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
+}
+
+// Hand out chunks in place of buffer and second_buffer
+static audioio_get_buffer_result_t wavefile_stream_get_buffer(audioio_wavefile_obj_t *self,
+    uint8_t channel,
+    uint32_t channel_read_count,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    bool need_more_data = self->read_count == channel_read_count;
+    if (need_more_data) {
+        uint32_t n = self->chunks_played;
+        if (!wavefile_chunk_ready(self, n)) {
+            // The read ahead didn't happen in time, or this is the last chunk.
+            // If this interrupted the read ahead, it will have the chunk soon,
+            // so play a little silence rather than wait for it here.
+            if (!wavefile_claim(self)) {
+                *buffer = self->silence;
+                *buffer_length = self->silence_length;
+                return GET_BUFFER_MORE_DATA;
+            }
+            bool ok = wavefile_read_ahead(self);
+            wavefile_release(self);
+            if (!ok) {
+                return GET_BUFFER_ERROR;
+            }
+            if (!wavefile_chunk_ready(self, n)) {
+                *buffer = NULL;
+                *buffer_length = 0;
+                return GET_BUFFER_DONE;
+            }
+        }
+        self->chunk_last = n % MP_ARRAY_SIZE(self->chunk);
+        STORE_SHARED(&self->chunks_played, n + 1);
+        self->read_count += 1;
+        if (LOAD_SHARED(&self->bytes_remaining) != 0) {
+            background_callback_add(&self->prefetch_cb, wavefile_prefetch_cb, self);
+        }
+    }
+
+    // A channel that is behind gets the chunk it missed
+    uint32_t chunks_back = self->read_count - 1 - channel_read_count;
+    uint8_t index = (self->chunk_last + MP_ARRAY_SIZE(self->chunk) - chunks_back) % MP_ARRAY_SIZE(self->chunk);
+    *buffer = self->chunk[index];
+    *buffer_length = self->chunk_length[index];
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + self->base.bits_per_sample / 8;
+    }
+
+    return wavefile_stream_result(self);
+}
+#endif
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
@@ -147,11 +352,20 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     }
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
-    self->bytes_remaining = self->file_length;
-    f_lseek(&self->file->fp, self->data_start);
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+    if (self->chunk_size) {
+        // This may be called in an interrupt while the read ahead has the
+        // file, so leave the rewind to whichever reads from it next.
+        STORE_SHARED(&self->rewinds_requested, self->rewinds_requested + 1);
+        background_callback_add(&self->prefetch_cb, wavefile_prefetch_cb, self);
+        return;
+    }
+    #endif
+    self->bytes_remaining = self->file_length;
+    f_lseek(&self->file->fp, self->data_start);
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -168,6 +382,12 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         channel_read_count = self->right_read_count;
     }
 
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+    if (self->chunk_size) {
+        return wavefile_stream_get_buffer(self, channel, channel_read_count, buffer, buffer_length);
+    }
+    #endif
+
     bool need_more_data = self->read_count == channel_read_count;
 
     if (self->bytes_remaining == 0 && need_more_data) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "extmod/vfs_fat.h"
+#include "supervisor/background_callback.h"
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
@@ -28,6 +29,34 @@ typedef struct {
     uint32_t read_count;
     uint32_t left_read_count;
     uint32_t right_read_count;
+
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_STREAMING
+    // When chunk_size is not zero, the file is read a chunk at a time into a
+    // ring of buffers outside the VM heap, instead of into buffer and
+    // second_buffer. One chunk is being played, one has been handed out to
+    // play next, and the third is read ahead by a background callback.
+    //
+    // get_buffer may be called from an interrupt while the read ahead is
+    // running. Only the context that holds `reading` uses the file, and each
+    // count below is written by only one side. The counts increase without
+    // bound (mod 2^32), and chunk n is chunk[n % 3].
+    uint8_t *chunk[3];
+    uint32_t chunk_length[3];
+    uint8_t *silence; // Played when get_buffer can't read the next chunk itself
+    uint32_t silence_length;
+    uint32_t chunk_size;
+    background_callback_t prefetch_cb;
+    bool reading;
+
+    // Only written while holding reading, along with bytes_remaining and the file
+    uint32_t chunks_read;
+    uint32_t rewinds_done;
+
+    // Only written by get_buffer and reset_buffer
+    uint32_t chunks_played;
+    uint32_t rewinds_requested;
+    uint8_t chunk_last; // The chunk handed out last
+    #endif
 } audioio_wavefile_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -6,8 +6,13 @@
 
 #include "shared-module/audioio/__init__.h"
 
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/mphal.h"
 #include "py/obj.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-module/audiocore/RawSample.h"
@@ -16,18 +21,111 @@
 #include "shared-bindings/audiomixer/Mixer.h"
 #include "shared-module/audiomixer/Mixer.h"
 
+#if CIRCUITPY_AUDIOCORE_STATS && !defined(MICROPY_UNIX_COVERAGE)
+#include "supervisor/port.h"
+#endif
+
 void audiosample_reset_buffer(mp_obj_t sample_obj, bool single_channel_output, uint8_t audio_channel) {
     const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
     proto->reset_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, audio_channel);
 }
 
+#if CIRCUITPY_AUDIOCORE_STATS
+#if defined(MICROPY_UNIX_COVERAGE)
+static uint64_t audiosample_stats_now_us(void) {
+    return mp_hal_ticks_us();
+}
+#else
+// The port's raw ticks are 1/1024 seconds, and each has 32 subticks. Ports
+// without subticks only time to the nearest tick.
+static uint64_t audiosample_stats_now_us(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return (((ticks << 5) | subticks) * 1000000) >> 15;
+}
+#endif
+
+static void audiosample_stats_record(audiosample_base_t *self, bool second_channel,
+    audioio_get_buffer_result_t result, uint32_t buffer_length, uint32_t elapsed_us) {
+    audiosample_stats_t *stats = &self->stats;
+    stats->calls += 1;
+    stats->time_us += elapsed_us;
+    stats->max_time_us = MAX(stats->max_time_us, elapsed_us);
+    if (result == GET_BUFFER_ERROR) {
+        stats->errors += 1;
+        return;
+    }
+    // With single channel output, the second channel gets the same frames again
+    if (second_channel) {
+        return;
+    }
+    uint32_t frames = buffer_length / (self->channel_count * self->bits_per_sample / 8);
+    stats->frames += frames;
+    if (frames == 0 && result == GET_BUFFER_MORE_DATA) {
+        stats->stalls += 1;
+    }
+    if ((uint64_t)elapsed_us * self->sample_rate > (uint64_t)frames * 1000000) {
+        stats->late += 1;
+    }
+}
+#endif
+
 audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
     bool single_channel_output,
     uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
+    #if CIRCUITPY_AUDIOCORE_STATS
+    uint64_t start = audiosample_stats_now_us();
+    audioio_get_buffer_result_t result = proto->get_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, channel, buffer, buffer_length);
+    audiosample_stats_record(MP_OBJ_TO_PTR(sample_obj), single_channel_output && channel == 1,
+        result, *buffer_length, audiosample_stats_now_us() - start);
+    return result;
+    #else
     return proto->get_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, channel, buffer, buffer_length);
+    #endif
+}
+
+#if CIRCUITPY_AUDIOCORE_RENDER
+uint32_t audiosample_render(mp_obj_t sample_obj, uint8_t *buffer, mp_obj_t stream, uint32_t frames, bool reset) {
+    audiosample_base_t *sample = audiosample_check(sample_obj);
+    uint32_t bytes_per_frame = sample->channel_count * sample->bits_per_sample / 8;
+
+    if (reset) {
+        audiosample_reset_buffer(sample_obj, false, 0);
+    }
+    uint32_t rendered = 0;
+    while (rendered < frames) {
+        uint8_t *data;
+        uint32_t length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample_obj, false, 0, &data, &length);
+        if (result == GET_BUFFER_ERROR) {
+            mp_raise_OSError(MP_EIO);
+        }
+
+        uint32_t n = MIN(length / bytes_per_frame, frames - rendered);
+        if (buffer != NULL) {
+            memcpy(buffer + rendered * bytes_per_frame, data, n * bytes_per_frame);
+        } else if (n != 0) {
+            int errcode;
+            mp_stream_write_exactly(stream, data, n * bytes_per_frame, &errcode);
+            if (errcode != 0) {
+                mp_raise_OSError(errcode);
+            }
+        }
+        rendered += n;
+
+        if (result == GET_BUFFER_DONE) {
+            break;
+        }
+        // Read ahead and streaming samples are filled by background tasks,
+        // which don't otherwise run during the loop
+        RUN_BACKGROUND_TASKS;
+        mp_handle_pending(true);
+    }
+    return rendered;
 }
+#endif
 
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
@@ -18,6 +18,21 @@ typedef enum {
     GET_BUFFER_ERROR,           // Error while reading data.
 } audioio_get_buffer_result_t;
 
+#if CIRCUITPY_AUDIOCORE_STATS
+// Counts kept by audiosample_get_buffer for each sample. Times include the
+// time taken by the sample's own sources.
+typedef struct {
+    uint32_t calls;
+    uint32_t frames;
+    uint64_t time_us;
+    uint32_t max_time_us;
+    uint32_t late; // buffers that took longer to make than to play
+    uint32_t stalls; // MORE_DATA results with no data
+    uint32_t errors;
+    uint32_t underruns; // times the output ran out of this sample's data
+} audiosample_stats_t;
+#endif
+
 typedef struct audiosample_base {
     mp_obj_base_t self;
     uint32_t sample_rate;
@@ -26,6 +41,9 @@ typedef struct audiosample_base {
     uint8_t channel_count;
     uint8_t samples_signed;
     bool single_buffer;
+    #if CIRCUITPY_AUDIOCORE_STATS
+    audiosample_stats_t stats;
+    #endif
 } audiosample_base_t;
 
 typedef void (*audiosample_reset_buffer_fun)(mp_obj_t,
@@ -89,8 +107,25 @@ static inline void audiosample_get_buffer_structure_checked(mp_obj_t self_in, bo
     audiosample_get_buffer_structure(audiosample_check(self_in), single_channel_output, single_buffer, samples_signed, max_buffer_length, spacing);
 }
 
+// Called by an audio output, possibly from an interrupt, when it ran out of
+// data from the sample it plays because the next buffer wasn't ready in time.
+static inline void audiosample_record_underrun(mp_obj_t sample_obj) {
+    #if CIRCUITPY_AUDIOCORE_STATS
+    ((audiosample_base_t *)MP_OBJ_TO_PTR(sample_obj))->stats.underruns += 1;
+    #else
+    (void)sample_obj;
+    #endif
+}
+
 void audiosample_must_match(audiosample_base_t *self, mp_obj_t other, bool allow_mono_to_stereo);
 
+#if CIRCUITPY_AUDIOCORE_RENDER
+// Play the sample into the buffer, or if it is NULL, write it to the stream,
+// until `frames` frames are done or the sample ends. Returns the number of
+// frames rendered.
+uint32_t audiosample_render(mp_obj_t sample_obj, uint8_t *buffer, mp_obj_t stream, uint32_t frames, bool reset);
+#endif
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_u8s_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_s8m_s16s(int16_t *buffer_out, const int8_t *buffer_in, size_t nframes);
@@ -188,6 +188,70 @@ void common_hal_audiodelays_chorus_stop(audiodelays_chorus_obj_t *self) {
     return;
 }
 
+// The block inputs, limited and converted for use on each sample
+typedef struct {
+    int32_t voices;
+    int32_t mix_down_scale;
+    mp_float_t mix;
+    uint32_t chorus_buf_len;
+    uint32_t max_chorus_buf_len;
+} chorus_params_t;
+
+static void chorus_get_params(audiodelays_chorus_obj_t *self, chorus_params_t *params) {
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    params->voices = (int32_t)MAX(synthio_block_slot_get(&self->voices), 1.0);
+    params->mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(params->voices);
+    params->mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+
+    mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+    if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+        chorus_recalculate_delay(self, f_delay_ms);
+    }
+
+    params->chorus_buf_len = self->chorus_buffer_len / sizeof(uint16_t);
+    params->max_chorus_buf_len = self->max_chorus_buffer_len / sizeof(uint16_t);
+}
+
+// Add one sample to the chorus buffer and mix the voices with it
+static int32_t chorus_word(audiodelays_chorus_obj_t *self, const chorus_params_t *params, int32_t sample_word) {
+    // The chorus buffer is always stored as a 16-bit value internally
+    int16_t *chorus_buffer = (int16_t *)self->chorus_buffer;
+    int32_t voices = params->voices;
+
+    chorus_buffer[self->chorus_buffer_pos++] = (int16_t)sample_word;
+
+    int32_t word = 0;
+    if (voices == 1) {
+        word = sample_word;
+    } else {
+        int32_t step = params->chorus_buf_len / (voices - 1) - 1;
+        int32_t c_pos = self->chorus_buffer_pos - 1;
+
+        for (int32_t v = 0; v < voices; v++) {
+            if (c_pos < 0) {
+                c_pos += params->max_chorus_buf_len;
+            }
+            word += chorus_buffer[c_pos];
+
+            c_pos -= step;
+        }
+
+        // Dividing would get an average but does not sound as good
+        // Leaving this here in case someone wants to try an average instead
+        // word = word / voices;
+
+        word = synthio_mix_down_sample(word, params->mix_down_scale);
+    }
+
+    if (self->chorus_buffer_pos >= params->max_chorus_buf_len) {
+        self->chorus_buffer_pos = 0;
+    }
+
+    // Add original sample + effect
+    word = sample_word + (int32_t)(word * params->mix);
+    return synthio_mix_down_sample(word, 2);
+}
+
 audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -199,11 +263,6 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
     int8_t *hword_buffer = self->buffer[self->last_buf_idx];
     uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
 
-    // The chorus buffer is always stored as a 16-bit value internally
-    int16_t *chorus_buffer = (int16_t *)self->chorus_buffer;
-    uint32_t chorus_buf_len = self->chorus_buffer_len / sizeof(uint16_t);
-    uint32_t max_chorus_buf_len = self->max_chorus_buffer_len / sizeof(uint16_t);
-
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
@@ -232,17 +291,9 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
             n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
         shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-
-        int32_t voices = (int32_t)MAX(synthio_block_slot_get(&self->voices), 1.0);
-        int32_t mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(voices);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-
-        mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
-        if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
-            chorus_recalculate_delay(self, f_delay_ms);
-        }
+        chorus_params_t params;
+        chorus_get_params(self, &params);
 
         if (self->sample == NULL) {
             if (self->base.samples_signed) {
@@ -275,34 +326,7 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
                     }
                 }
 
-                chorus_buffer[self->chorus_buffer_pos++] = (int16_t)sample_word;
-
-                int32_t word = 0;
-                if (voices == 1) {
-                    word = sample_word;
-                } else {
-                    int32_t step = chorus_buf_len / (voices - 1) - 1;
-                    int32_t c_pos = self->chorus_buffer_pos - 1;
-
-                    for (int32_t v = 0; v < voices; v++) {
-                        if (c_pos < 0) {
-                            c_pos += max_chorus_buf_len;
-                        }
-                        word += chorus_buffer[c_pos];
-
-                        c_pos -= step;
-                    }
-
-                    // Dividing would get an average but does not sound as good
-                    // Leaving this here in case someone wants to try an average instead
-                    // word = word / voices;
-
-                    word = synthio_mix_down_sample(word, mix_down_scale);
-                }
-
-                // Add original sample + effect
-                word = sample_word + (int32_t)(word * mix);
-                word = synthio_mix_down_sample(word, 2);
+                int32_t word = chorus_word(self, &params, sample_word);
 
                 if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                     word_buffer[i] = word;
@@ -317,10 +341,6 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
                         hword_buffer[i] = (uint8_t)out ^ 0x80;
                     }
                 }
-
-                if (self->chorus_buffer_pos >= max_chorus_buf_len) {
-                    self->chorus_buffer_pos = 0;
-                }
             }
             self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
             self->sample_buffer_length -= n;
@@ -338,3 +358,12 @@ audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj
     // Chorus always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiodelays_chorus_process(audiodelays_chorus_obj_t *self, int32_t *samples, uint32_t n) {
+    chorus_params_t params;
+    chorus_get_params(self, &params);
+
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = chorus_word(self, &params, samples[i]);
+    }
+}
@@ -227,6 +227,85 @@ void common_hal_audiodelays_echo_stop(audiodelays_echo_obj_t *self) {
     return;
 }
 
+// The block inputs, limited and converted for use on each sample
+typedef struct {
+    mp_float_t mix;
+    mp_float_t decay;
+    uint32_t echo_buf_len;
+    uint32_t max_echo_buf_len;
+} echo_params_t;
+
+static void echo_get_params(audiodelays_echo_obj_t *self, echo_params_t *params) {
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    params->mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
+    params->decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+
+    mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+    if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+        recalculate_delay(self, f_delay_ms);
+    }
+
+    params->echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
+    params->max_echo_buf_len = (self->max_echo_buffer_len >> (self->base.channel_count - 1)) / sizeof(uint16_t);
+}
+
+// Feed one sample into the echo buffer and mix the echo with it
+static int32_t echo_word(audiodelays_echo_obj_t *self, const echo_params_t *params, int32_t sample_word, bool right_channel, bool eight_bit) {
+    // The echo buffer is always stored as a 16-bit value internally
+    int16_t *echo_buffer = (int16_t *)self->echo_buffer;
+    uint32_t echo_buf_len = params->echo_buf_len;
+    mp_float_t decay = params->decay;
+    mp_float_t mix = params->mix;
+
+    int32_t echo, word = 0;
+    uint32_t next_buffer_pos = 0;
+
+    // Get our echo buffer position and offset depending on current channel
+    uint32_t echo_buffer_offset = right_channel ? params->max_echo_buf_len : 0;
+    uint32_t echo_buffer_pos = right_channel ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
+
+    if (self->freq_shift) {
+        echo = echo_buffer[(echo_buffer_pos >> 8) + echo_buffer_offset];
+        next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
+
+        for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
+            word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
+            if (eight_bit) {
+                // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
+                word = MIN(MAX(word, -128), 127);
+            } else {
+                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+            }
+            echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)word;
+        }
+        echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
+    } else {
+        echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
+        word = (int32_t)(echo * decay + sample_word);
+        if (eight_bit) {
+            // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
+            word = MIN(MAX(word, -128), 127);
+        } else {
+            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+        }
+        echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)word;
+        if (echo_buffer_pos >= echo_buf_len) {
+            echo_buffer_pos = 0;
+        }
+    }
+
+    // Update buffer position
+    if (right_channel) {
+        self->echo_buffer_right_pos = echo_buffer_pos;
+    } else {
+        self->echo_buffer_left_pos = echo_buffer_pos;
+    }
+
+    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
+        + (echo * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
+    return synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+}
+
 audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -273,18 +352,13 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
             n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
         shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
-        mp_float_t decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-
-        mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
-        if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
-            recalculate_delay(self, f_delay_ms);
-        }
-
-        uint32_t echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
-        uint32_t max_echo_buf_len = (self->max_echo_buffer_len >> (self->base.channel_count - 1)) / sizeof(uint16_t);
+        echo_params_t params;
+        echo_get_params(self, &params);
+        mp_float_t mix = params.mix;
+        mp_float_t decay = params.decay;
+        uint32_t echo_buf_len = params.echo_buf_len;
+        uint32_t max_echo_buf_len = params.max_echo_buf_len;
 
         // If we have no sample keep the echo echoing
         if (self->sample == NULL) {
@@ -383,50 +457,8 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                         }
                     }
 
-                    int32_t echo, word = 0;
-                    uint32_t next_buffer_pos = 0;
-
-                    // Get our echo buffer position and offset depending on current channel
-                    uint32_t echo_buffer_offset = max_echo_buf_len * ((single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1));
-                    uint32_t echo_buffer_pos = echo_buffer_offset ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
-
-                    if (self->freq_shift) {
-                        echo = echo_buffer[(echo_buffer_pos >> 8) + echo_buffer_offset];
-                        next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
-                    } else {
-                        echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
-                        word = (int32_t)(echo * decay + sample_word);
-                    }
-
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        if (self->freq_shift) {
-                            for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                                word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
-                                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)word;
-                            }
-                        } else {
-                            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)word;
-                        }
-                    } else {
-                        if (self->freq_shift) {
-                            for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                                word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
-                                // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                                word = MIN(MAX(word, -128), 127);
-                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int8_t)word;
-                            }
-                        } else {
-                            // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                            word = MIN(MAX(word, -128), 127);
-                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int8_t)word;
-                        }
-                    }
-
-                    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
-                        + (echo * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
-                    word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                    bool right_channel = (single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1);
+                    int32_t word = echo_word(self, &params, sample_word, right_channel, self->base.bits_per_sample == 8);
 
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                         word_buffer[i] = (int16_t)word;
@@ -441,19 +473,6 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
                             hword_buffer[i] = (uint8_t)mixed ^ 0x80;
                         }
                     }
-
-                    if (self->freq_shift) {
-                        echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
-                    } else if (!self->freq_shift && echo_buffer_pos >= echo_buf_len) {
-                        echo_buffer_pos = 0;
-                    }
-
-                    // Update buffer position
-                    if (echo_buffer_offset) {
-                        self->echo_buffer_right_pos = echo_buffer_pos;
-                    } else {
-                        self->echo_buffer_left_pos = echo_buffer_pos;
-                    }
                 }
             }
 
@@ -473,3 +492,16 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
     // Echo always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiodelays_echo_process(audiodelays_echo_obj_t *self, int32_t *samples, uint32_t n) {
+    echo_params_t params;
+    echo_get_params(self, &params);
+
+    if (params.mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
+        return;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = echo_word(self, &params, samples[i], (i % self->base.channel_count) == 1, false);
+    }
+}
@@ -55,3 +55,7 @@ audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *
     uint8_t channel,
     uint8_t **buffer,
     uint32_t *buffer_length);  // length in bytes
+
+// Used by audioeffects.Chain. Applies the effect in place to n interleaved
+// 16 bit samples held in int32s, which are at most SYNTHIO_MAX_DUR frames.
+void audiodelays_echo_process(audiodelays_echo_obj_t *self, int32_t *samples, uint32_t n);
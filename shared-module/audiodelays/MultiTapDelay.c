@@ -308,6 +308,71 @@ void common_hal_audiodelays_multi_tap_delay_stop(audiodelays_multi_tap_delay_obj
     return;
 }
 
+// The block inputs, limited and converted for use on each sample
+typedef struct {
+    mp_float_t mix;
+    mp_float_t decay;
+    int32_t mix_down_scale;
+    uint32_t delay_buffer_len; // per channel
+} multi_tap_delay_params_t;
+
+static void multi_tap_delay_get_params(audiodelays_multi_tap_delay_obj_t *self, multi_tap_delay_params_t *params) {
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    params->mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
+    params->decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    params->mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(self->tap_len);
+    params->delay_buffer_len = self->delay_buffer_len / self->base.channel_count / sizeof(uint16_t);
+}
+
+// Feed one sample into the delay buffer at delay_buffer_pos and mix the taps with it
+static int32_t multi_tap_delay_word(audiodelays_multi_tap_delay_obj_t *self, const multi_tap_delay_params_t *params, int32_t sample_word,
+    uint32_t delay_buffer_pos, uint32_t delay_buffer_offset, bool eight_bit) {
+    // The delay buffer is always stored as a 16-bit value internally
+    int16_t *delay_buffer = (int16_t *)self->delay_buffer;
+    uint32_t delay_buffer_len = params->delay_buffer_len;
+
+    // Pull words from delay buffer at tap positions, apply level and mix down
+    int32_t word = 0;
+    int32_t delay_word;
+    if (self->tap_len) {
+        size_t tap_pos;
+        for (size_t j = 0; j < self->tap_len; j++) {
+            tap_pos = (delay_buffer_pos + delay_buffer_len - self->tap_offsets[j]) % delay_buffer_len;
+            delay_word = delay_buffer[tap_pos + delay_buffer_offset];
+            word += (int32_t)(delay_word * self->tap_levels[j]);
+        }
+
+        if (self->tap_len > 1) {
+            word = synthio_mix_down_sample(word, params->mix_down_scale);
+        }
+    }
+
+    // Update delay buffer with sample and decay
+    delay_word = delay_buffer[delay_buffer_pos + delay_buffer_offset];
+
+    // If no taps are provided, use as standard delay
+    if (!self->tap_len) {
+        word = delay_word;
+    }
+
+    // Apply decay and add sample
+    delay_word = (int32_t)(delay_word * params->decay) + sample_word;
+
+    if (eight_bit) {
+        // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
+        delay_word = MIN(MAX(delay_word, -128), 127);
+    } else {
+        delay_word = synthio_mix_down_sample(delay_word, SYNTHIO_MIX_DOWN_SCALE(2));
+    }
+    delay_buffer[delay_buffer_pos + delay_buffer_offset] = (int16_t)delay_word;
+
+    // Mix sample with tap output
+    mp_float_t mix = params->mix;
+    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
+        + (word * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
+    return synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+}
+
 audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_multi_tap_delay_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -323,17 +388,11 @@ audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_m
     int8_t *hword_buffer = self->buffer[self->last_buf_idx];
     uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
 
-    // The delay buffer is always stored as a 16-bit value internally
-    int16_t *delay_buffer = (int16_t *)self->delay_buffer;
-    uint32_t delay_buffer_len = self->delay_buffer_len / self->base.channel_count / sizeof(uint16_t);
-
     uint32_t delay_buffer_pos = self->delay_buffer_pos;
     if (single_channel_output && channel == 1) {
         delay_buffer_pos = self->delay_buffer_right_pos;
     }
 
-    int32_t mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(self->tap_len);
-
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
@@ -362,10 +421,9 @@ audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_m
             n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
         shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
-        mp_float_t decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+        multi_tap_delay_params_t params;
+        multi_tap_delay_get_params(self, &params);
 
         int16_t *sample_src = NULL;
         int8_t *sample_hsrc = NULL;
@@ -376,7 +434,7 @@ audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_m
         }
 
         for (uint32_t i = 0; i < n; i++) {
-            uint32_t delay_buffer_offset = delay_buffer_len * ((single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1));
+            uint32_t delay_buffer_offset = params.delay_buffer_len * ((single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1));
 
             int32_t sample_word = 0;
             if (self->sample != NULL) {
@@ -392,46 +450,7 @@ audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_m
                 }
             }
 
-            // Pull words from delay buffer at tap positions, apply level and mix down
-            int32_t word = 0;
-            int32_t delay_word;
-            if (self->tap_len) {
-                size_t tap_pos;
-                for (size_t j = 0; j < self->tap_len; j++) {
-                    tap_pos = (delay_buffer_pos + delay_buffer_len - self->tap_offsets[j]) % delay_buffer_len;
-                    delay_word = delay_buffer[tap_pos + delay_buffer_offset];
-                    word += (int32_t)(delay_word * self->tap_levels[j]);
-                }
-
-                if (self->tap_len > 1) {
-                    word = synthio_mix_down_sample(word, mix_down_scale);
-                }
-            }
-
-            // Update delay buffer with sample and decay
-            delay_word = delay_buffer[delay_buffer_pos + delay_buffer_offset];
-
-            // If no taps are provided, use as standard delay
-            if (!self->tap_len) {
-                word = delay_word;
-            }
-
-            // Apply decay and add sample
-            delay_word = (int32_t)(delay_word * decay) + sample_word;
-
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                delay_word = synthio_mix_down_sample(delay_word, SYNTHIO_MIX_DOWN_SCALE(2));
-                delay_buffer[delay_buffer_pos + delay_buffer_offset] = (int16_t)delay_word;
-            } else {
-                // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                delay_word = MIN(MAX(delay_word, -128), 127);
-                delay_buffer[delay_buffer_pos + delay_buffer_offset] = (int8_t)delay_word;
-            }
-
-            // Mix sample with tap output
-            word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
-                + (word * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
-            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+            int32_t word = multi_tap_delay_word(self, &params, sample_word, delay_buffer_pos, delay_buffer_offset, self->base.bits_per_sample == 8);
 
             if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                 word_buffer[i] = (int16_t)word;
@@ -448,7 +467,7 @@ audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_m
             }
 
             if ((self->base.channel_count == 1 || single_channel_output || (!single_channel_output && (i % self->base.channel_count) == 1))
-                && ++delay_buffer_pos >= delay_buffer_len) {
+                && ++delay_buffer_pos >= params.delay_buffer_len) {
                 delay_buffer_pos = 0;
             }
         }
@@ -476,3 +495,22 @@ audioio_get_buffer_result_t audiodelays_multi_tap_delay_get_buffer(audiodelays_m
     // MultiTapDelay always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiodelays_multi_tap_delay_process(audiodelays_multi_tap_delay_obj_t *self, int32_t *samples, uint32_t n) {
+    multi_tap_delay_params_t params;
+    multi_tap_delay_get_params(self, &params);
+    uint32_t delay_buffer_pos = self->delay_buffer_pos;
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t delay_buffer_offset = params.delay_buffer_len * ((i % self->base.channel_count) == 1);
+
+        samples[i] = multi_tap_delay_word(self, &params, samples[i], delay_buffer_pos, delay_buffer_offset, false);
+
+        if ((self->base.channel_count == 1 || (i % self->base.channel_count) == 1)
+            && ++delay_buffer_pos >= params.delay_buffer_len) {
+            delay_buffer_pos = 0;
+        }
+    }
+
+    self->delay_buffer_pos = delay_buffer_pos;
+}
@@ -165,6 +165,93 @@ void common_hal_audiodelays_pitch_shift_stop(audiodelays_pitch_shift_obj_t *self
     return;
 }
 
+// The block inputs, limited and converted for use on each sample
+typedef struct {
+    mp_float_t mix;
+    uint32_t window_size; // per channel
+    uint32_t overlap_size; // per channel
+} pitch_shift_params_t;
+
+static void pitch_shift_get_params(audiodelays_pitch_shift_obj_t *self, pitch_shift_params_t *params) {
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    mp_float_t semitones = synthio_block_slot_get(&self->semitones);
+    params->mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
+
+    // Only recalculate rate if semitones has changes
+    if (memcmp(&semitones, &self->current_semitones, sizeof(mp_float_t))) {
+        recalculate_rate(self, semitones);
+    }
+
+    params->window_size = self->window_len / sizeof(uint16_t) / self->base.channel_count;
+    params->overlap_size = self->overlap_len / sizeof(uint16_t) / self->base.channel_count;
+}
+
+// Write one sample into the window, read the shifted sample back and mix it with the original.
+// The window moves on after the last channel of each frame.
+static int32_t pitch_shift_word(audiodelays_pitch_shift_obj_t *self, const pitch_shift_params_t *params, int32_t sample_word, bool buf_offset) {
+    // The window and overlap buffers are always stored as a 16-bit value internally
+    int16_t *window_buffer = (int16_t *)self->window_buffer;
+    int16_t *overlap_buffer = (int16_t *)self->overlap_buffer;
+    uint32_t window_size = params->window_size;
+    uint32_t overlap_size = params->overlap_size;
+
+    if (overlap_size) {
+        // Copy last sample from overlap and store in buffer
+        window_buffer[self->window_index + window_size * buf_offset] = overlap_buffer[self->overlap_index + overlap_size * buf_offset];
+
+        // Save current sample in overlap
+        overlap_buffer[self->overlap_index + overlap_size * buf_offset] = (int16_t)sample_word;
+    } else {
+        // Write sample to buffer
+        window_buffer[self->window_index + window_size * buf_offset] = (int16_t)sample_word;
+    }
+
+    // Determine how far we are into the overlap
+    uint32_t read_index = self->read_index >> PITCH_READ_SHIFT;
+    uint32_t read_overlap_offset = read_index + window_size * (read_index < self->window_index) - self->window_index;
+
+    // Read sample from buffer
+    int32_t word = (int32_t)window_buffer[read_index + window_size * buf_offset];
+
+    // Check if we're within the overlap range and mix buffer sample with overlap sample
+    if (overlap_size && read_overlap_offset > 0 && read_overlap_offset <= overlap_size) {
+        // Apply volume based on overlap position to buffer sample
+        word *= (int32_t)read_overlap_offset;
+
+        // Add overlap with volume based on overlap position
+        word += (int32_t)overlap_buffer[((self->overlap_index + read_overlap_offset) % overlap_size) + overlap_size * buf_offset] * (int32_t)(overlap_size - read_overlap_offset);
+
+        // Scale down
+        word /= (int32_t)overlap_size;
+    }
+
+    if (self->base.channel_count == 1 || buf_offset) {
+        // Increment window buffer write pointer
+        self->window_index++;
+        if (self->window_index >= window_size) {
+            self->window_index = 0;
+        }
+
+        // Increment overlap buffer pointer
+        if (overlap_size) {
+            self->overlap_index++;
+            if (self->overlap_index >= overlap_size) {
+                self->overlap_index = 0;
+            }
+        }
+
+        // Increment window buffer read pointer by rate
+        self->read_index += self->read_rate;
+        if (self->read_index >= window_size << PITCH_READ_SHIFT) {
+            self->read_index -= window_size << PITCH_READ_SHIFT;
+        }
+    }
+
+    mp_float_t mix = params->mix;
+    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0))) + (word * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
+    return synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+}
+
 audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch_shift_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -180,17 +267,6 @@ audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch
     int8_t *hword_buffer = self->buffer[self->last_buf_idx];
     uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
 
-    // The window and overlap buffers are always stored as a 16-bit value internally
-    int16_t *window_buffer = (int16_t *)self->window_buffer;
-    uint32_t window_size = self->window_len / sizeof(uint16_t) / self->base.channel_count;
-
-    int16_t *overlap_buffer = NULL;
-    uint32_t overlap_size = 0;
-    if (self->overlap_len) {
-        overlap_buffer = (int16_t *)self->overlap_buffer;
-        overlap_size = self->overlap_len / sizeof(uint16_t) / self->base.channel_count;
-    }
-
     // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
     while (length != 0) {
         // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
@@ -237,15 +313,9 @@ audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch
             int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
             int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
 
-            // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
             shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-            mp_float_t semitones = synthio_block_slot_get(&self->semitones);
-            mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
-
-            // Only recalculate rate if semitones has changes
-            if (memcmp(&semitones, &self->current_semitones, sizeof(mp_float_t))) {
-                recalculate_rate(self, semitones);
-            }
+            pitch_shift_params_t params;
+            pitch_shift_get_params(self, &params);
 
             for (uint32_t i = 0; i < n; i++) {
                 bool buf_offset = (channel == 1 || i % self->base.channel_count == 1);
@@ -262,38 +332,7 @@ audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch
                     }
                 }
 
-                if (overlap_size) {
-                    // Copy last sample from overlap and store in buffer
-                    window_buffer[self->window_index + window_size * buf_offset] = overlap_buffer[self->overlap_index + overlap_size * buf_offset];
-
-                    // Save current sample in overlap
-                    overlap_buffer[self->overlap_index + overlap_size * buf_offset] = (int16_t)sample_word;
-                } else {
-                    // Write sample to buffer
-                    window_buffer[self->window_index + window_size * buf_offset] = (int16_t)sample_word;
-                }
-
-                // Determine how far we are into the overlap
-                uint32_t read_index = self->read_index >> PITCH_READ_SHIFT;
-                uint32_t read_overlap_offset = read_index + window_size * (read_index < self->window_index) - self->window_index;
-
-                // Read sample from buffer
-                int32_t word = (int32_t)window_buffer[read_index + window_size * buf_offset];
-
-                // Check if we're within the overlap range and mix buffer sample with overlap sample
-                if (overlap_size && read_overlap_offset > 0 && read_overlap_offset <= overlap_size) {
-                    // Apply volume based on overlap position to buffer sample
-                    word *= (int32_t)read_overlap_offset;
-
-                    // Add overlap with volume based on overlap position
-                    word += (int32_t)overlap_buffer[((self->overlap_index + read_overlap_offset) % overlap_size) + overlap_size * buf_offset] * (int32_t)(overlap_size - read_overlap_offset);
-
-                    // Scale down
-                    word /= (int32_t)overlap_size;
-                }
-
-                word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0))) + (word * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
-                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                int32_t word = pitch_shift_word(self, &params, sample_word, buf_offset);
 
                 if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                     word_buffer[i] = (int16_t)word;
@@ -308,28 +347,6 @@ audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch
                         hword_buffer[i] = (uint8_t)mixed ^ 0x80;
                     }
                 }
-
-                if (self->base.channel_count == 1 || buf_offset) {
-                    // Increment window buffer write pointer
-                    self->window_index++;
-                    if (self->window_index >= window_size) {
-                        self->window_index = 0;
-                    }
-
-                    // Increment overlap buffer pointer
-                    if (overlap_size) {
-                        self->overlap_index++;
-                        if (self->overlap_index >= overlap_size) {
-                            self->overlap_index = 0;
-                        }
-                    }
-
-                    // Increment window buffer read pointer by rate
-                    self->read_index += self->read_rate;
-                    if (self->read_index >= window_size << PITCH_READ_SHIFT) {
-                        self->read_index -= window_size << PITCH_READ_SHIFT;
-                    }
-                }
             }
 
             // Update the remaining length and the buffer positions based on how much we wrote into our buffer
@@ -348,3 +365,12 @@ audioio_get_buffer_result_t audiodelays_pitch_shift_get_buffer(audiodelays_pitch
     // PitchShift always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiodelays_pitch_shift_process(audiodelays_pitch_shift_obj_t *self, int32_t *samples, uint32_t n) {
+    pitch_shift_params_t params;
+    pitch_shift_get_params(self, &params);
+
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = pitch_shift_word(self, &params, samples[i], i % self->base.channel_count == 1);
+    }
+}
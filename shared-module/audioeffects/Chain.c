@@ -0,0 +1,256 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audioeffects/Chain.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/objtuple.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-module/synthio/__init__.h"
+
+#if CIRCUITPY_AUDIODELAYS
+#include "shared-bindings/audiodelays/Chorus.h"
+#include "shared-bindings/audiodelays/Echo.h"
+#include "shared-bindings/audiodelays/MultiTapDelay.h"
+#include "shared-bindings/audiodelays/PitchShift.h"
+#endif
+#if CIRCUITPY_AUDIOFILTERS
+#include "shared-bindings/audiofilters/Distortion.h"
+#include "shared-bindings/audiofilters/Filter.h"
+#include "shared-bindings/audiofilters/Phaser.h"
+#endif
+#if CIRCUITPY_AUDIOFREEVERB
+#include "shared-bindings/audiofreeverb/Freeverb.h"
+#endif
+
+static const struct {
+    const mp_obj_type_t *type;
+    audioeffects_process_fun process;
+} chain_kernels[] = {
+    #if CIRCUITPY_AUDIODELAYS
+    { &audiodelays_chorus_type, (audioeffects_process_fun)audiodelays_chorus_process },
+    { &audiodelays_echo_type, (audioeffects_process_fun)audiodelays_echo_process },
+    { &audiodelays_multi_tap_delay_type, (audioeffects_process_fun)audiodelays_multi_tap_delay_process },
+    { &audiodelays_pitch_shift_type, (audioeffects_process_fun)audiodelays_pitch_shift_process },
+    #endif
+    #if CIRCUITPY_AUDIOFILTERS
+    { &audiofilters_distortion_type, (audioeffects_process_fun)audiofilters_distortion_process },
+    { &audiofilters_filter_type, (audioeffects_process_fun)audiofilters_filter_process },
+    { &audiofilters_phaser_type, (audioeffects_process_fun)audiofilters_phaser_process },
+    #endif
+    #if CIRCUITPY_AUDIOFREEVERB
+    { &audiofreeverb_freeverb_type, (audioeffects_process_fun)audiofreeverb_freeverb_process },
+    #endif
+};
+
+static audioeffects_process_fun chain_find_kernel(mp_obj_t effect) {
+    const mp_obj_type_t *type = mp_obj_get_type(effect);
+    for (size_t i = 0; i < MP_ARRAY_SIZE(chain_kernels); i++) {
+        if (chain_kernels[i].type == type) {
+            return chain_kernels[i].process;
+        }
+    }
+    mp_raise_TypeError_varg(MP_ERROR_TEXT("unsupported %q type"), type->name);
+}
+
+void common_hal_audioeffects_chain_construct(audioeffects_chain_obj_t *self,
+    size_t effect_count, const mp_obj_t *effects, uint32_t buffer_size) {
+
+    // The chain plays in the same format as its effects, which must all agree
+    audiosample_base_t *first = audiosample_check(effects[0]);
+    self->base.sample_rate = first->sample_rate;
+    self->base.channel_count = first->channel_count;
+    self->base.bits_per_sample = first->bits_per_sample;
+    self->base.samples_signed = first->samples_signed;
+    self->base.single_buffer = false;
+    self->base.max_buffer_length = buffer_size;
+
+    // Function pointers don't need to be scanned by the gc
+    self->process = m_malloc_without_collect(effect_count * sizeof(audioeffects_process_fun));
+    for (size_t i = 0; i < effect_count; i++) {
+        audiosample_must_match(&self->base, effects[i], false);
+        self->process[i] = chain_find_kernel(effects[i]);
+    }
+    self->effects = mp_obj_new_tuple(effect_count, effects);
+    self->effect_count = effect_count;
+
+    self->work = m_malloc_without_collect(SYNTHIO_MAX_DUR * self->base.channel_count * sizeof(int32_t));
+
+    self->buffer_len = buffer_size; // in bytes
+    self->buffer[0] = m_malloc_without_collect(self->buffer_len);
+    memset(self->buffer[0], 0, self->buffer_len);
+    self->buffer[1] = m_malloc_without_collect(self->buffer_len);
+    memset(self->buffer[1], 0, self->buffer_len);
+    self->last_buf_idx = 1;
+
+    self->sample = NULL;
+    self->sample_remaining_buffer = NULL;
+    self->sample_buffer_length = 0;
+    self->loop = false;
+    self->more_data = false;
+}
+
+void common_hal_audioeffects_chain_deinit(audioeffects_chain_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->work = NULL;
+    self->process = NULL;
+    self->effects = mp_const_empty_tuple;
+    self->effect_count = 0;
+    self->sample = NULL;
+}
+
+mp_obj_t common_hal_audioeffects_chain_get_effects(audioeffects_chain_obj_t *self) {
+    return self->effects;
+}
+
+void audioeffects_chain_reset_buffer(audioeffects_chain_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+
+    memset(self->buffer[0], 0, self->buffer_len);
+    memset(self->buffer[1], 0, self->buffer_len);
+
+    // Clears the effects' delay lines and filter states
+    mp_obj_tuple_t *effects = MP_OBJ_TO_PTR(self->effects);
+    for (size_t i = 0; i < self->effect_count; i++) {
+        audiosample_reset_buffer(effects->items[i], false, 0);
+    }
+}
+
+bool common_hal_audioeffects_chain_get_playing(audioeffects_chain_obj_t *self) {
+    return self->sample != NULL;
+}
+
+void common_hal_audioeffects_chain_play(audioeffects_chain_obj_t *self, mp_obj_t sample, bool loop) {
+    audiosample_must_match(&self->base, sample, false);
+
+    self->sample = sample;
+    self->loop = loop;
+
+    audiosample_reset_buffer(self->sample, false, 0);
+    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+
+    // Track remaining sample length in terms of bytes per sample
+    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
+    // Store if we have more data in the sample to retrieve
+    self->more_data = result == GET_BUFFER_MORE_DATA;
+}
+
+void common_hal_audioeffects_chain_stop(audioeffects_chain_obj_t *self) {
+    self->sample = NULL;
+}
+
+// Widen samples to 16 bit signed values in int32s. 8 bit samples are scaled
+// up, because the effects' levels and limits are for 16 bit samples.
+static void chain_convert_in(audioeffects_chain_obj_t *self, int32_t *work, const uint8_t *src, uint32_t n) {
+    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+        const int16_t *src16 = (const int16_t *)(const void *)src;
+        if (self->base.samples_signed) {
+            for (uint32_t i = 0; i < n; i++) {
+                work[i] = src16[i];
+            }
+        } else {
+            for (uint32_t i = 0; i < n; i++) {
+                work[i] = (int16_t)(src16[i] ^ 0x8000);
+            }
+        }
+    } else {
+        const int8_t *src8 = (const int8_t *)src;
+        int8_t flip = self->base.samples_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < n; i++) {
+            work[i] = (int8_t)(src8[i] ^ flip) * 256;
+        }
+    }
+}
+
+static void chain_convert_out(audioeffects_chain_obj_t *self, uint8_t *dest, const int32_t *work, uint32_t n) {
+    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+        int16_t *dest16 = (int16_t *)(void *)dest;
+        int16_t flip = self->base.samples_signed ? 0 : 0x8000;
+        for (uint32_t i = 0; i < n; i++) {
+            dest16[i] = synthio_sat16(work[i], 0) ^ flip;
+        }
+    } else {
+        int8_t *dest8 = (int8_t *)dest;
+        int8_t flip = self->base.samples_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < n; i++) {
+            dest8[i] = (int8_t)(synthio_sat16(work[i], 0) >> 8) ^ flip;
+        }
+    }
+}
+
+audioio_get_buffer_result_t audioeffects_chain_get_buffer(audioeffects_chain_obj_t *self, bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+    uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
+
+    // The second channel was produced along with the first
+    if (single_channel_output && channel == 1) {
+        *buffer = (uint8_t *)self->buffer[self->last_buf_idx] + bytes_per_sample;
+        *buffer_length = self->buffer_len;
+        return GET_BUFFER_MORE_DATA;
+    }
+
+    // Switch our buffers to the other buffer
+    self->last_buf_idx = !self->last_buf_idx;
+
+    uint8_t *out = (uint8_t *)self->buffer[self->last_buf_idx];
+    uint32_t length = self->buffer_len / bytes_per_sample;
+    mp_obj_tuple_t *effects = MP_OBJ_TO_PTR(self->effects);
+
+    while (length != 0) {
+        // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
+        if (self->sample_buffer_length == 0) {
+            if (!self->more_data) {
+                if (self->loop && self->sample) {
+                    audiosample_reset_buffer(self->sample, false, 0);
+                } else {
+                    self->sample = NULL;
+                }
+            }
+            if (self->sample) {
+                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
+                self->sample_buffer_length /= bytes_per_sample;
+                self->more_data = result == GET_BUFFER_MORE_DATA;
+            }
+        }
+
+        // Without a sample the effects still run on silence, so echoes and reverb die away
+        uint32_t n = MIN(length, SYNTHIO_MAX_DUR * self->base.channel_count);
+        if (self->sample == NULL) {
+            memset(self->work, 0, n * sizeof(int32_t));
+        } else {
+            n = MIN(n, self->sample_buffer_length);
+            chain_convert_in(self, self->work, self->sample_remaining_buffer, n);
+            self->sample_remaining_buffer += n * bytes_per_sample;
+            self->sample_buffer_length -= n;
+        }
+
+        // The block inputs are ticked once, so every effect sees the same values
+        shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
+        for (size_t i = 0; i < self->effect_count; i++) {
+            self->process[i](effects->items[i], self->work, n);
+        }
+
+        chain_convert_out(self, out, self->work, n);
+        out += n * bytes_per_sample;
+        length -= n;
+    }
+
+    *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
+    *buffer_length = self->buffer_len;
+
+    // Like the effects, a chain always returns more data
+    return GET_BUFFER_MORE_DATA;
+}
@@ -0,0 +1,47 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Applies one effect in place to a block of int32 samples. See the _process
+// functions of the effects in audiodelays, audiofilters and audiofreeverb.
+typedef void (*audioeffects_process_fun)(mp_obj_t effect, int32_t *samples, uint32_t n);
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t effects; // tuple
+    size_t effect_count;
+    audioeffects_process_fun *process;
+
+    // One block of samples, converted to int32 once for all of the effects
+    int32_t *work;
+
+    int8_t *buffer[2];
+    uint8_t last_buf_idx;
+    uint32_t buffer_len; // max buffer in bytes
+
+    uint8_t *sample_remaining_buffer;
+    uint32_t sample_buffer_length; // samples
+
+    bool loop;
+    bool more_data;
+
+    mp_obj_t sample;
+} audioeffects_chain_obj_t;
+
+void audioeffects_chain_reset_buffer(audioeffects_chain_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+
+audioio_get_buffer_result_t audioeffects_chain_get_buffer(audioeffects_chain_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);  // length in bytes
@@ -49,3 +49,7 @@ void audiofilters_distortion_reset_buffer(audiofilters_distortion_obj_t *self,
 audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_distortion_obj_t *self,
     bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length);
+
+// Used by audioeffects.Chain. Applies the effect in place to n interleaved
+// 16 bit samples held in int32s, which are at most SYNTHIO_MAX_DUR frames.
+void audiofilters_distortion_process(audiofilters_distortion_obj_t *self, int32_t *samples, uint32_t n);
@@ -165,6 +165,20 @@ void common_hal_audiofilters_filter_stop(audiofilters_filter_obj_t *self) {
     return;
 }
 
+// Run the first n_samples of filter_buffer, at most SYNTHIO_MAX_DUR, through each biquad in turn
+static void filter_samples(audiofilters_filter_obj_t *self, uint32_t n_samples) {
+    for (uint8_t j = 0; j < self->filter_states_len; j++) {
+        mp_obj_t filter_obj = self->filter_objs[j];
+        common_hal_synthio_biquad_tick(filter_obj);
+        synthio_biquad_filter_samples(filter_obj, &self->filter_states[j], self->filter_buffer, n_samples);
+    }
+}
+
+// Mix one filtered sample with the original
+static int32_t filter_mix(int32_t sample_word, int32_t filtered, mp_float_t mix) {
+    return (int32_t)((sample_word * (MICROPY_FLOAT_CONST(1.0) - mix)) + (filtered * mix));
+}
+
 audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     (void)channel;
@@ -264,25 +278,20 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                         }
                     }
 
-                    // Process biquad filters
-                    for (uint8_t j = 0; j < self->filter_states_len; j++) {
-                        mp_obj_t filter_obj = self->filter_objs[j];
-                        common_hal_synthio_biquad_tick(filter_obj);
-                        synthio_biquad_filter_samples(filter_obj, &self->filter_states[j], self->filter_buffer, n_samples);
-                    }
+                    filter_samples(self, n_samples);
 
                     // Mix processed signal with original sample and transfer to output buffer
                     for (uint32_t j = 0; j < n_samples; j++) {
                         if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                            word_buffer[i + j] = synthio_mix_down_sample((int32_t)((sample_src[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[j] * mix)), SYNTHIO_MIX_DOWN_SCALE(2));
+                            word_buffer[i + j] = synthio_mix_down_sample(filter_mix(sample_src[i + j], self->filter_buffer[j], mix), SYNTHIO_MIX_DOWN_SCALE(2));
                             if (!self->base.samples_signed) {
                                 word_buffer[i + j] ^= 0x8000;
                             }
                         } else {
                             if (self->base.samples_signed) {
-                                hword_buffer[i + j] = (int8_t)((sample_hsrc[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[j] * mix));
+                                hword_buffer[i + j] = (int8_t)filter_mix(sample_hsrc[i + j], self->filter_buffer[j], mix);
                             } else {
-                                hword_buffer[i + j] = (uint8_t)(((int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80) * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[j] * mix)) ^ 0x80;
+                                hword_buffer[i + j] = (uint8_t)filter_mix((int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80), self->filter_buffer[j], mix) ^ 0x80;
                             }
                         }
                     }
@@ -307,3 +316,27 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
     // Filter always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiofilters_filter_process(audiofilters_filter_obj_t *self, int32_t *samples, uint32_t n) {
+    mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+
+    if (mix <= MICROPY_FLOAT_CONST(0.01) || !self->filter_states) { // if mix is zero pure sample only or no biquad filter objects are provided
+        return;
+    }
+
+    uint32_t i = 0;
+    while (i < n) {
+        uint32_t n_samples = MIN(SYNTHIO_MAX_DUR, n - i);
+
+        memcpy(self->filter_buffer, samples + i, n_samples * sizeof(int32_t));
+
+        filter_samples(self, n_samples);
+
+        // Mix processed signal with original sample
+        for (uint32_t j = 0; j < n_samples; j++) {
+            samples[i + j] = synthio_mix_down_sample(filter_mix(samples[i + j], self->filter_buffer[j], mix), SYNTHIO_MIX_DOWN_SCALE(2));
+        }
+
+        i += n_samples;
+    }
+}
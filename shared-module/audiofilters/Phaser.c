@@ -152,6 +152,45 @@ void common_hal_audiofilters_phaser_stop(audiofilters_phaser_obj_t *self) {
     return;
 }
 
+// The block inputs, limited and converted to fixed point for use on each sample
+typedef struct {
+    int16_t feedback;
+    int16_t mix;
+    int16_t allpasscoef;
+} phaser_params_t;
+
+static void phaser_get_params(audiofilters_phaser_obj_t *self, phaser_params_t *params) {
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    mp_float_t frequency = synthio_block_slot_get_limited(&self->frequency, MICROPY_FLOAT_CONST(0.0), self->nyquist);
+    params->feedback = (int16_t)(synthio_block_slot_get_limited(&self->feedback, MICROPY_FLOAT_CONST(0.1), MICROPY_FLOAT_CONST(0.9)) * 32767);
+    params->mix = (int16_t)(synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * 32767);
+
+    // Update all-pass filter coefficient
+    frequency /= self->nyquist; // scale relative to frequency range
+    params->allpasscoef = (int16_t)((MICROPY_FLOAT_CONST(1.0) - frequency) / (MICROPY_FLOAT_CONST(1.0) + frequency) * 32767);
+}
+
+// Pass one sample through the all-pass stages and mix it with the original
+static int32_t phaser_word(audiofilters_phaser_obj_t *self, const phaser_params_t *params, int32_t sample_word, bool right_channel) {
+    uint32_t allpass_buffer_offset = self->stages * right_channel;
+    int16_t allpasscoef = params->allpasscoef;
+
+    int32_t word = synthio_sat16(sample_word + synthio_sat16((int32_t)self->word_buffer[right_channel] * params->feedback, 15), 0);
+    int32_t allpass_word = 0;
+
+    // Update all-pass filters
+    for (uint32_t j = 0; j < self->stages; j++) {
+        allpass_word = synthio_sat16(synthio_sat16(word * -allpasscoef, 15) + self->allpass_buffer[j + allpass_buffer_offset], 0);
+        self->allpass_buffer[j + allpass_buffer_offset] = synthio_sat16(synthio_sat16(allpass_word * allpasscoef, 15) + word, 0);
+        word = allpass_word;
+    }
+    self->word_buffer[(bool)allpass_buffer_offset] = (int16_t)word;
+
+    // Add original sample + effect
+    word = sample_word + (int32_t)(synthio_sat16(word * params->mix, 15));
+    return synthio_mix_down_sample(word, 2);
+}
+
 audioio_get_buffer_result_t audiofilters_phaser_get_buffer(audiofilters_phaser_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     (void)channel;
@@ -218,13 +257,11 @@ audioio_get_buffer_result_t audiofilters_phaser_get_buffer(audiofilters_phaser_o
             int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
             int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
 
-            // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
             shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-            mp_float_t frequency = synthio_block_slot_get_limited(&self->frequency, MICROPY_FLOAT_CONST(0.0), self->nyquist);
-            int16_t feedback = (int16_t)(synthio_block_slot_get_limited(&self->feedback, MICROPY_FLOAT_CONST(0.1), MICROPY_FLOAT_CONST(0.9)) * 32767);
-            int16_t mix = (int16_t)(synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * 32767);
+            phaser_params_t params;
+            phaser_get_params(self, &params);
 
-            if (mix <= 328) { // if mix is zero (0.01 in fixed point), pure sample only
+            if (params.mix <= 328) { // if mix is zero (0.01 in fixed point), pure sample only
                 for (uint32_t i = 0; i < n; i++) {
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                         word_buffer[i] = sample_src[i];
@@ -233,13 +270,8 @@ audioio_get_buffer_result_t audiofilters_phaser_get_buffer(audiofilters_phaser_o
                     }
                 }
             } else {
-                // Update all-pass filter coefficient
-                frequency /= self->nyquist; // scale relative to frequency range
-                int16_t allpasscoef = (int16_t)((MICROPY_FLOAT_CONST(1.0) - frequency) / (MICROPY_FLOAT_CONST(1.0) + frequency) * 32767);
-
                 for (uint32_t i = 0; i < n; i++) {
                     bool right_channel = (single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1);
-                    uint32_t allpass_buffer_offset = self->stages * right_channel;
 
                     int32_t sample_word = 0;
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
@@ -253,20 +285,7 @@ audioio_get_buffer_result_t audiofilters_phaser_get_buffer(audiofilters_phaser_o
                         }
                     }
 
-                    int32_t word = synthio_sat16(sample_word + synthio_sat16((int32_t)self->word_buffer[right_channel] * feedback, 15), 0);
-                    int32_t allpass_word = 0;
-
-                    // Update all-pass filters
-                    for (uint32_t j = 0; j < self->stages; j++) {
-                        allpass_word = synthio_sat16(synthio_sat16(word * -allpasscoef, 15) + self->allpass_buffer[j + allpass_buffer_offset], 0);
-                        self->allpass_buffer[j + allpass_buffer_offset] = synthio_sat16(synthio_sat16(allpass_word * allpasscoef, 15) + word, 0);
-                        word = allpass_word;
-                    }
-                    self->word_buffer[(bool)allpass_buffer_offset] = (int16_t)word;
-
-                    // Add original sample + effect
-                    word = sample_word + (int32_t)(synthio_sat16(word * mix, 15));
-                    word = synthio_mix_down_sample(word, 2);
+                    int32_t word = phaser_word(self, &params, sample_word, right_channel);
 
                     if (MP_LIKELY(self->base.bits_per_sample == 16)) {
                         word_buffer[i] = word;
@@ -300,3 +319,16 @@ audioio_get_buffer_result_t audiofilters_phaser_get_buffer(audiofilters_phaser_o
     // Phaser always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiofilters_phaser_process(audiofilters_phaser_obj_t *self, int32_t *samples, uint32_t n) {
+    phaser_params_t params;
+    phaser_get_params(self, &params);
+
+    if (params.mix <= 328) { // if mix is zero (0.01 in fixed point), pure sample only
+        return;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = phaser_word(self, &params, samples[i], (i % self->base.channel_count) == 1);
+    }
+}
@@ -217,6 +217,65 @@ void common_hal_audiofreeverb_freeverb_stop(audiofreeverb_freeverb_obj_t *self)
     return;
 }
 
+// The block inputs, converted to fixed point for use on each sample
+typedef struct {
+    int16_t damp1, damp2;
+    int16_t mix_sample, mix_effect;
+    int16_t feedback;
+} freeverb_params_t;
+
+static void freeverb_get_params(audiofreeverb_freeverb_obj_t *self, freeverb_params_t *params) {
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    mp_float_t damp = synthio_block_slot_get_limited(&self->damp, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    audiofreeverb_freeverb_get_damp_fixedpoint(damp, &params->damp1, &params->damp2);
+
+    mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    audiofreeverb_freeverb_get_mix_fixedpoint(mix, &params->mix_sample, &params->mix_effect);
+
+    mp_float_t roomsize = synthio_block_slot_get_limited(&self->roomsize, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    params->feedback = audiofreeverb_freeverb_get_roomsize_fixedpoint(roomsize);
+}
+
+// Pass one sample through the comb and all-pass filters and mix the reverb with it.
+// Each channel of a stereo sample has its own filters, so the two reverb tails
+// are decorrelated: the right channel uses combs 8..15 and all-passes 4..7.
+static int32_t freeverb_word(audiofreeverb_freeverb_obj_t *self, const freeverb_params_t *params, int32_t sample_word, uint8_t channel) {
+    int32_t word, sum;
+    int16_t input, bufout, output;
+    uint32_t channel_comb_offset = channel * 8, channel_allpass_offset = channel * 4;
+
+    input = synthio_sat16(sample_word * 8738, 17); // Initial input scaled down so we can add reverb
+    sum = 0;
+
+    // Calculate each of the 8 comb buffers
+    for (uint32_t j = 0 + channel_comb_offset; j < 8 + channel_comb_offset; j++) {
+        bufout = self->combbuffers[j][self->combbufferindex[j]];
+        sum += bufout;
+        self->combfitlers[j] = synthio_sat16(bufout * params->damp2 + self->combfitlers[j] * params->damp1, 15);
+        self->combbuffers[j][self->combbufferindex[j]] = synthio_sat16(input + synthio_sat16(self->combfitlers[j] * params->feedback, 15), 0);
+        if (++self->combbufferindex[j] >= self->combbuffersizes[j]) {
+            self->combbufferindex[j] = 0;
+        }
+    }
+
+    output = synthio_sat16(sum * 31457, 17); // 31457 = 0.24f with shift of 17
+
+    // Calculate each of the 4 all pass buffers
+    for (uint32_t j = 0 + channel_allpass_offset; j < 4 + channel_allpass_offset; j++) {
+        bufout = self->allpassbuffers[j][self->allpassbufferindex[j]];
+        self->allpassbuffers[j][self->allpassbufferindex[j]] = output + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
+        output = synthio_sat16(bufout - output, 1);
+        if (++self->allpassbufferindex[j] >= self->allpassbuffersizes[j]) {
+            self->allpassbufferindex[j] = 0;
+        }
+    }
+
+    word = output * 30; // Add some volume back don't have to saturate as next step will
+
+    word = synthio_sat16(sample_word * params->mix_sample, 15) + synthio_sat16(word * params->mix_effect, 15);
+    return synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+}
+
 audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_freeverb_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -255,18 +314,9 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
             n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
         shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-        mp_float_t damp = synthio_block_slot_get_limited(&self->damp, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-        int16_t damp1, damp2;
-        audiofreeverb_freeverb_get_damp_fixedpoint(damp, &damp1, &damp2);
-
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-        int16_t mix_sample, mix_effect;
-        audiofreeverb_freeverb_get_mix_fixedpoint(mix, &mix_sample, &mix_effect);
-
-        mp_float_t roomsize = synthio_block_slot_get_limited(&self->roomsize, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-        int16_t feedback = audiofreeverb_freeverb_get_roomsize_fixedpoint(roomsize);
+        freeverb_params_t params;
+        freeverb_get_params(self, &params);
 
         int16_t *sample_src = (int16_t *)self->sample_remaining_buffer;
 
@@ -276,49 +326,8 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
                 sample_word = sample_src[i];
             }
 
-            int32_t word, sum;
-            int16_t input, bufout, output;
-            uint32_t channel_comb_offset = 0, channel_allpass_offset = 0;
-
-            input = synthio_sat16(sample_word * 8738, 17); // Initial input scaled down so we can add reverb
-            sum = 0;
-
-            // Calculate each of the 8 comb buffers
-            for (uint32_t j = 0 + channel_comb_offset; j < 8 + channel_comb_offset; j++) {
-                bufout = self->combbuffers[j][self->combbufferindex[j]];
-                sum += bufout;
-                self->combfitlers[j] = synthio_sat16(bufout * damp2 + self->combfitlers[j] * damp1, 15);
-                self->combbuffers[j][self->combbufferindex[j]] = synthio_sat16(input + synthio_sat16(self->combfitlers[j] * feedback, 15), 0);
-                if (++self->combbufferindex[j] >= self->combbuffersizes[j]) {
-                    self->combbufferindex[j] = 0;
-                }
-            }
-
-            output = synthio_sat16(sum * 31457, 17); // 31457 = 0.24f with shift of 17
-
-            // Calculate each of the 4 all pass buffers
-            for (uint32_t j = 0 + channel_allpass_offset; j < 4 + channel_allpass_offset; j++) {
-                bufout = self->allpassbuffers[j][self->allpassbufferindex[j]];
-                self->allpassbuffers[j][self->allpassbufferindex[j]] = output + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
-                output = synthio_sat16(bufout - output, 1);
-                if (++self->allpassbufferindex[j] >= self->allpassbuffersizes[j]) {
-                    self->allpassbufferindex[j] = 0;
-                }
-            }
-
-            word = output * 30; // Add some volume back don't have to saturate as next step will
-
-            word = synthio_sat16(sample_word * mix_sample, 15) + synthio_sat16(word * mix_effect, 15);
-            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-            word_buffer[i] = (int16_t)word;
-
-            if ((self->base.channel_count == 2) && (channel_comb_offset == 0)) {
-                channel_comb_offset = 8;
-                channel_allpass_offset = 4;
-            } else {
-                channel_comb_offset = 0;
-                channel_allpass_offset = 0;
-            }
+            // n is a whole number of frames, so i % channel_count is the sample's channel
+            word_buffer[i] = (int16_t)freeverb_word(self, &params, sample_word, i % self->base.channel_count);
         }
 
         // Update the remaining length and the buffer positions based on how much we wrote into our buffer
@@ -335,3 +344,12 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
     // Reverb always returns more data but some effects may return GET_BUFFER_DONE or GET_BUFFER_ERROR (see audiocore/__init__.h)
     return GET_BUFFER_MORE_DATA;
 }
+
+void audiofreeverb_freeverb_process(audiofreeverb_freeverb_obj_t *self, int32_t *samples, uint32_t n) {
+    freeverb_params_t params;
+    freeverb_get_params(self, &params);
+
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = freeverb_word(self, &params, samples[i], i % self->base.channel_count);
+    }
+}
@@ -51,6 +51,10 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
     uint8_t **buffer,
     uint32_t *buffer_length);  // length in bytes
 
+// Used by audioeffects.Chain. Applies the effect in place to n interleaved
+// 16 bit samples held in int32s, which are at most SYNTHIO_MAX_DUR frames.
+void audiofreeverb_freeverb_process(audiofreeverb_freeverb_obj_t *self, int32_t *samples, uint32_t n);
+
 int16_t audiofreeverb_freeverb_get_roomsize_fixedpoint(mp_float_t n);
 void audiofreeverb_freeverb_get_damp_fixedpoint(mp_float_t n, int16_t *damp1, int16_t *damp2);
 void audiofreeverb_freeverb_get_mix_fixedpoint(mp_float_t mix, int16_t *mix_sample, int16_t *mix_effect);
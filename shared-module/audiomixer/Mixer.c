@@ -70,81 +70,31 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
     }
 }
 
-__attribute__((always_inline))
-static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __QADD16(a, b);
-    #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = a >> (sizeof(int16_t) * 8 * i);
-        int16_t bi = b >> (sizeof(int16_t) * 8 * i);
-        int32_t intermediate = (int32_t)ai + bi;
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
-        }
-        result |= (((uint32_t)intermediate) & 0xffff) << (sizeof(int16_t) * 8 * i);
-    }
-    return result;
-    #endif
-}
+// The mixing kernels below use the DSP extension's SIMD instructions when the
+// core has them, which includes Cortex-M4, M7 and M33. Otherwise they work on
+// one 16 or 8 bit sample at a time, in plain C that compilers can vectorize
+// for the host's SIMD unit.
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define MIXER_KERNEL_DSP (1)
+#else
+#define MIXER_KERNEL_DSP (0)
+#endif
 
+#if MIXER_KERNEL_DSP
+// Scale the two 16 bit samples in val by mul, which is at most 1 << 15. mul is
+// shifted up by one less than smulw* shifts down, so the result is the same as
+// (val * mul) >> 15, saturated.
 __attribute__((always_inline))
-static inline uint32_t mult16signed(uint32_t val, int32_t mul[2]) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    mul[0] <<= 16;
-    mul[1] <<= 16;
+static inline uint32_t mult16signed(uint32_t val, const int32_t mul[2]) {
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
-    enum { shift = 15 }; // shift is done automatically
-    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul[0]), "r" (val));
-    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul[1]), "r" (val));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
+    enum { shift = 14 }; // the other 16 bits of shift are done by smulw*
+    asm ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul[0] << 15), "r" (val));
+    asm ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul[1] << 15), "r" (val));
+    asm ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
+    asm ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
+    asm ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
-    #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        float mod_mul = (float)mul[i] / (float)((1 << 15) - 1);
-        int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
-        }
-        intermediate &= 0x0000FFFF;
-        result |= (((uint32_t)intermediate)) << (sizeof(int16_t) * 8 * i);
-    }
-    return result;
-    #endif
-}
-
-static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD8(val, 0x80808080);
-    #else
-    return val ^ 0x80808080;
-    #endif
-}
-
-static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD16(val, 0x80008000);
-    #else
-    return val ^ 0x80008000;
-    #endif
-}
-
-static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD16(val, 0x80008000);
-    #else
-    return val ^ 0x80008000;
-    #endif
 }
 
 static inline uint32_t unpack8(uint16_t val) {
@@ -164,15 +114,132 @@ static inline uint32_t copy16msb(uint32_t val) {
     val &= 0xffff0000;
     return val | (val >> 16);
 }
+#else
+static inline int32_t mix_sat16(int32_t val) {
+    return MIN(MAX(val, SHRT_MIN), SHRT_MAX);
+}
+#endif
+
+// Scale n words of 16 bit samples from src by loudness, and store them in dst or
+// add them to it with saturation. flip converts unsigned samples to signed.
+// When upmix is true, src has mono samples that are copied to both channels of
+// dst, and n / 2 words of it are used.
+static inline MP_ALWAYSINLINE void mix16_block(uint32_t *dst, const uint32_t *src, uint32_t n,
+    uint32_t flip, const int32_t loudness[2], bool upmix, bool accumulate) {
+    #if MIXER_KERNEL_DSP
+    if (upmix) {
+        for (uint32_t i = 0; i + 1 < n; i += 2) {
+            uint32_t v = src[i >> 1] ^ flip;
+            uint32_t lo = mult16signed(copy16lsb(v), loudness);
+            uint32_t hi = mult16signed(copy16msb(v), loudness);
+            dst[i] = accumulate ? __QADD16(lo, dst[i]) : lo;
+            dst[i + 1] = accumulate ? __QADD16(hi, dst[i + 1]) : hi;
+        }
+    } else {
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t v = mult16signed(src[i] ^ flip, loudness);
+            dst[i] = accumulate ? __QADD16(v, dst[i]) : v;
+        }
+    }
+    #else
+    int16_t *dst16 = (int16_t *)dst;
+    const int16_t *src16 = (const int16_t *)src;
+    int16_t flip16 = (int16_t)flip;
+    int32_t left = loudness[0], right = loudness[1];
+    uint32_t lanes = upmix ? (n & ~1) * 2 : n * 2;
+    for (uint32_t i = 0; i < lanes; i += 2) {
+        int32_t l = (int16_t)(src16[upmix ? i >> 1 : i] ^ flip16);
+        int32_t r = (int16_t)(src16[upmix ? i >> 1 : i + 1] ^ flip16);
+        l = (l * left) >> 15;
+        r = (r * right) >> 15;
+        if (accumulate) {
+            l += dst16[i];
+            r += dst16[i + 1];
+        }
+        dst16[i] = mix_sat16(l);
+        dst16[i + 1] = mix_sat16(r);
+    }
+    #endif
+}
 
-static inline uint32_t copy8lsb(uint32_t val) {
-    val &= 0x00ff;
-    return val | (val << 8);
+// The same for 8 bit samples, which are scaled and added as 16 bit values. n is
+// still in words, so it covers 4 * n samples of dst.
+static inline MP_ALWAYSINLINE void mix8_block(uint32_t *dst, const uint32_t *src, uint32_t n,
+    uint32_t flip, const int32_t loudness[2], bool upmix, bool accumulate) {
+    #if MIXER_KERNEL_DSP
+    uint16_t *hdst = (uint16_t *)dst;
+    const uint16_t *hsrc = (const uint16_t *)src;
+    // The samples are unpacked to the top of 16 bit lanes before they're flipped
+    flip &= 0x80008000;
+    if (upmix) {
+        for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
+            uint32_t v = unpack8(hsrc[i >> 1]) ^ flip;
+            uint32_t lo = mult16signed(copy16lsb(v), loudness);
+            uint32_t hi = mult16signed(copy16msb(v), loudness);
+            hdst[i] = pack8(accumulate ? __QADD16(lo, unpack8(hdst[i])) : lo);
+            hdst[i + 1] = pack8(accumulate ? __QADD16(hi, unpack8(hdst[i + 1])) : hi);
+        }
+    } else {
+        for (uint32_t i = 0; i < n * 2; i++) {
+            uint32_t v = mult16signed(unpack8(hsrc[i]) ^ flip, loudness);
+            hdst[i] = pack8(accumulate ? __QADD16(v, unpack8(hdst[i])) : v);
+        }
+    }
+    #else
+    int8_t *dst8 = (int8_t *)dst;
+    const int8_t *src8 = (const int8_t *)src;
+    int8_t flip8 = (int8_t)flip;
+    int32_t left = loudness[0], right = loudness[1];
+    for (uint32_t i = 0; i < n * 4; i += 2) {
+        int32_t l = (int8_t)(src8[upmix ? i >> 1 : i] ^ flip8) * 256;
+        int32_t r = (int8_t)(src8[upmix ? i >> 1 : i + 1] ^ flip8) * 256;
+        l = (l * left) >> 15;
+        r = (r * right) >> 15;
+        if (accumulate) {
+            l += dst8[i] * 256;
+            r += dst8[i + 1] * 256;
+        }
+        dst8[i] = mix_sat16(l) >> 8;
+        dst8[i + 1] = mix_sat16(r) >> 8;
+    }
+    #endif
 }
 
-static inline uint32_t copy8msb(uint32_t val) {
-    val &= 0xff00;
-    return val | (val >> 8);
+// Pick the kernel for the sample format, specialized for each case so the inner
+// loops have no branches.
+static void mix_block(audiomixer_mixer_obj_t *self, bool upmix, bool accumulate,
+    uint32_t *dst, const uint32_t *src, uint32_t n, const int32_t loudness[2]) {
+    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+        uint32_t flip = self->base.samples_signed ? 0 : 0x80008000;
+        if (MP_LIKELY(!upmix)) {
+            if (accumulate) {
+                mix16_block(dst, src, n, flip, loudness, false, true);
+            } else {
+                mix16_block(dst, src, n, flip, loudness, false, false);
+            }
+        } else {
+            if (accumulate) {
+                mix16_block(dst, src, n, flip, loudness, true, true);
+            } else {
+                mix16_block(dst, src, n, flip, loudness, true, false);
+            }
+        }
+    } else {
+        uint32_t flip = self->base.samples_signed ? 0 : 0x80808080;
+        if (MP_LIKELY(!upmix)) {
+            if (accumulate) {
+                mix8_block(dst, src, n, flip, loudness, false, true);
+            } else {
+                mix8_block(dst, src, n, flip, loudness, false, false);
+            }
+        } else {
+            if (accumulate) {
+                mix8_block(dst, src, n, flip, loudness, true, true);
+            } else {
+                mix8_block(dst, src, n, flip, loudness, true, false);
+            }
+        }
+    }
 }
 
 #define ALMOST_ONE (MICROPY_FLOAT_CONST(32767.) / 32768)
@@ -200,8 +267,6 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
             }
         }
 
-        uint32_t *src = voice->remaining_buffer;
-
         #if CIRCUITPY_SYNTHIO
         uint32_t n;
         if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
@@ -240,117 +305,10 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
             loudness[1] = (right_panning_scaled * loudness[1]) >> 15;
         }
 
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t v = src[i];
-                            word_buffer[i] = mult16signed(v, loudness);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i < n; i += 2) {
-                            uint32_t v = src[i >> 1];
-                            word_buffer[i] = mult16signed(copy16lsb(v), loudness);
-                            word_buffer[i + 1] = mult16signed(copy16msb(v), loudness);
-                        }
-                    }
-                } else {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t v = src[i];
-                            v = tosigned16(v);
-                            word_buffer[i] = mult16signed(v, loudness);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t v = src[i >> 1];
-                            v = tosigned16(v);
-                            word_buffer[i] = mult16signed(copy16lsb(v), loudness);
-                            word_buffer[i + 1] = mult16signed(copy16msb(v), loudness);
-                        }
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                    for (uint32_t i = 0; i < n * 2; i++) {
-                        uint32_t word = unpack8(hsrc[i]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        word = mult16signed(word, loudness);
-                        hword_buffer[i] = pack8(word);
-                    }
-                } else {
-                    for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
-                        uint32_t word = unpack8(hsrc[i >> 1]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        hword_buffer[i] = pack8(mult16signed(copy16lsb(word), loudness));
-                        hword_buffer[i + 1] = pack8(mult16signed(copy16msb(word), loudness));
-                    }
-                }
-            }
-        } else {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t word = src[i];
-                            word_buffer[i] = add16signed(mult16signed(word, loudness), word_buffer[i]);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t word = src[i >> 1];
-                            word_buffer[i] = add16signed(mult16signed(copy16lsb(word), loudness), word_buffer[i]);
-                            word_buffer[i + 1] = add16signed(mult16signed(copy16msb(word), loudness), word_buffer[i + 1]);
-                        }
-                    }
-                } else {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t word = src[i];
-                            word = tosigned16(word);
-                            word_buffer[i] = add16signed(mult16signed(word, loudness), word_buffer[i]);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t word = src[i >> 1];
-                            word = tosigned16(word);
-                            word_buffer[i] = add16signed(mult16signed(copy16lsb(word), loudness), word_buffer[i]);
-                            word_buffer[i + 1] = add16signed(mult16signed(copy16msb(word), loudness), word_buffer[i + 1]);
-                        }
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                    for (uint32_t i = 0; i < n * 2; i++) {
-                        uint32_t word = unpack8(hsrc[i]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        word = mult16signed(word, loudness);
-                        word = add16signed(word, unpack8(hword_buffer[i]));
-                        hword_buffer[i] = pack8(word);
-                    }
-                } else {
-                    for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
-                        uint32_t word = unpack8(hsrc[i >> 1]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        hword_buffer[i] = pack8(add16signed(mult16signed(copy16lsb(word), loudness), unpack8(hword_buffer[i])));
-                        hword_buffer[i + 1] = pack8(add16signed(mult16signed(copy16msb(word), loudness), unpack8(hword_buffer[i + 1])));
-                    }
-                }
-            }
-        }
+        // The first active voice is stored, and later ones are added to it
+        mix_block(self, self->base.channel_count != sample->channel_count, voices_active,
+            word_buffer, voice->remaining_buffer, n, loudness);
+
         length -= n;
         word_buffer += n;
         if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
@@ -415,11 +373,11 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t *
         if (!self->base.samples_signed) {
             if (self->base.bits_per_sample == 16) {
                 for (uint32_t i = 0; i < length; i++) {
-                    word_buffer[i] = tounsigned16(word_buffer[i]);
+                    word_buffer[i] ^= 0x80008000;
                 }
             } else {
                 for (uint32_t i = 0; i < length; i++) {
-                    word_buffer[i] = tounsigned8(word_buffer[i]);
+                    word_buffer[i] ^= 0x80808080;
                 }
             }
         }
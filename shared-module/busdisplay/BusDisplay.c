@@ -20,6 +20,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -63,6 +64,9 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
 
     self->native_frames_per_second = native_frames_per_second;
     self->native_ms_per_frame = 1000 / native_frames_per_second;
+    self->refresh_buffer = NULL;
+    self->refresh_mask = NULL;
+    self->refresh_buffer_size = 0;
 
     uint32_t i = 0;
     while (i < init_sequence_len) {
@@ -136,6 +140,10 @@ uint16_t common_hal_busdisplay_busdisplay_get_height(busdisplay_busdisplay_obj_t
     return displayio_display_core_get_height(&self->core);
 }
 
+mp_obj_t common_hal_busdisplay_busdisplay_get_refresh_stats(busdisplay_busdisplay_obj_t *self) {
+    return displayio_display_core_get_refresh_stats(&self->core);
+}
+
 mp_float_t common_hal_busdisplay_busdisplay_get_brightness(busdisplay_busdisplay_obj_t *self) {
     return self->current_brightness;
 }
@@ -196,12 +204,54 @@ mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_o
     return self->core.current_group;
 }
 
+// The default buffer used when the display doesn't have its own. In uint32_ts.
+#define DEFAULT_REFRESH_BUFFER_SIZE (128)
+
+// A display has one refresh buffer, not a pair to render into while the other is sent. Every
+// display bus send() blocks until its transfer is done, so a second buffer would never be in
+// flight. Overlapping the two needs a non-blocking send in FourWire, I2CDisplayBus and
+// ParallelBus on each port first.
+
+static void _free_refresh_buffer(busdisplay_busdisplay_obj_t *self) {
+    port_free(self->refresh_buffer);
+    port_free(self->refresh_mask);
+    self->refresh_buffer = NULL;
+    self->refresh_mask = NULL;
+    self->refresh_buffer_size = 0;
+}
+
+bool common_hal_busdisplay_busdisplay_set_refresh_buffer_size(busdisplay_busdisplay_obj_t *self, uint32_t refresh_buffer_size) {
+    _free_refresh_buffer(self);
+    uint32_t buffer_size = (refresh_buffer_size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    if (buffer_size <= DEFAULT_REFRESH_BUFFER_SIZE) {
+        return true;
+    }
+    // One mask bit per pixel that fits in the buffer.
+    uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
+    uint32_t mask_length = (buffer_size * pixels_per_word) / 32 + 1;
+    // The buffer is handed straight to the bus so it must be DMA capable. It lives outside the VM
+    // heap because the display outlives the VM.
+    uint32_t *buffer = port_malloc(buffer_size * sizeof(uint32_t), true);
+    uint32_t *mask = port_malloc(mask_length * sizeof(uint32_t), false);
+    if (buffer == NULL || mask == NULL) {
+        // Keep refreshing from the default stack buffer.
+        port_free(buffer);
+        port_free(mask);
+        return false;
+    }
+    self->refresh_buffer = buffer;
+    self->refresh_mask = mask;
+    self->refresh_buffer_size = buffer_size;
+    return true;
+}
+
 static const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
-        return &self->core.area;
+        return displayio_display_core_plan_refresh_areas(&self->core, &self->core.area);
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        const displayio_area_t *dirty_areas = displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_display_core_plan_refresh_areas(&self->core, dirty_areas);
     }
     return NULL;
 }
@@ -214,7 +264,10 @@ static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uin
 }
 
 static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+    uint32_t buffer_size = DEFAULT_REFRESH_BUFFER_SIZE; // In uint32_ts
+    if (self->refresh_buffer != NULL) {
+        buffer_size = self->refresh_buffer_size;
+    }
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -223,7 +276,7 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
     }
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
-    uint16_t pixels_per_buffer = displayio_area_size(&clipped);
+    uint32_t pixels_per_buffer = displayio_area_size(&clipped);
 
     uint16_t subrectangles = 1;
     // for SH1107 and other boundary constrained controllers
@@ -231,6 +284,7 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
     if (self->bus.SH1107_addressing) {
         subrectangles = rows_per_buffer / 8;  // page addressing mode writes 8 rows at a time
         rows_per_buffer = 8;
+        pixels_per_buffer = rows_per_buffer * displayio_area_width(&clipped);
     } else if (displayio_area_size(&clipped) > buffer_size * pixels_per_word) {
         rows_per_buffer = buffer_size * pixels_per_word / displayio_area_width(&clipped);
         if (rows_per_buffer == 0) {
@@ -254,11 +308,21 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
     }
 
+    uint32_t mask_length = (pixels_per_buffer / 32) + 1;
+    uint32_t *buffer = self->refresh_buffer;
+    uint32_t *mask = self->refresh_mask;
+    // A single row may be wider than the display's own buffer so fall back to the stack then too.
+    if (buffer_size > self->refresh_buffer_size) {
+        buffer = NULL;
+    }
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
-    uint32_t mask_length = (pixels_per_buffer / 32) + 1;
-    uint32_t mask[mask_length];
+    uint32_t stack_buffer[buffer == NULL ? buffer_size : 1];
+    uint32_t stack_mask[buffer == NULL ? mask_length : 1];
+    if (buffer == NULL) {
+        buffer = stack_buffer;
+        mask = stack_mask;
+    }
     uint16_t remaining_rows = displayio_area_height(&clipped);
 
     for (uint16_t j = 0; j < subrectangles; j++) {
@@ -275,15 +339,25 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
 
         displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
 
-        uint16_t subrectangle_size_bytes;
+        uint32_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) * (self->core.colorspace.depth / 8);
         } else {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
-        memset(mask, 0, mask_length * sizeof(mask[0]));
-        memset(buffer, 0, buffer_size * sizeof(buffer[0]));
+        // Only clear what this subrectangle uses so small areas don't pay for a large buffer.
+        uint32_t subrectangle_pixels = displayio_area_size(&subrectangle);
+        uint32_t subrectangle_buffer_pixels = subrectangle_pixels;
+        if (self->core.colorspace.depth < 8 && !self->core.colorspace.pixels_in_byte_share_row) {
+            // Pixels packed by column fill whole bytes of rows, even in a short last subrectangle.
+            uint8_t pixels_per_byte = 8 / self->core.colorspace.depth;
+            uint16_t packed_rows = (displayio_area_height(&subrectangle) + pixels_per_byte - 1) / pixels_per_byte * pixels_per_byte;
+            subrectangle_buffer_pixels = packed_rows * displayio_area_width(&subrectangle);
+        }
+        uint32_t subrectangle_words = MIN((subrectangle_buffer_pixels + pixels_per_word - 1) / pixels_per_word, buffer_size);
+        memset(mask, 0, MIN(subrectangle_pixels / 32 + 1, mask_length) * sizeof(mask[0]));
+        memset(buffer, 0, subrectangle_words * sizeof(buffer[0]));
 
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
 
@@ -408,6 +482,7 @@ void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self) {
 void release_busdisplay(busdisplay_busdisplay_obj_t *self) {
     common_hal_busdisplay_busdisplay_set_auto_refresh(self, false);
     release_display_core(&self->core);
+    _free_refresh_buffer(self);
     #if (CIRCUITPY_PWMIO)
     if (self->backlight_pwm.base.type == &pwmio_pwmout_type) {
         common_hal_pwmio_pwmout_deinit(&self->backlight_pwm);
@@ -26,6 +26,9 @@ typedef struct {
         pwmio_pwmout_obj_t backlight_pwm;
         #endif
     };
+    uint32_t *refresh_buffer; // DMA capable pixel buffer outside the VM heap. NULL to use the stack.
+    uint32_t *refresh_mask;
+    uint32_t refresh_buffer_size; // In uint32_ts
     uint64_t last_refresh_call;
     mp_float_t current_brightness;
     uint16_t brightness_command;
@@ -402,6 +402,19 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
 
 
 
+bool displayio_convert_color_is_opaque(const _displayio_colorspace_t *colorspace) {
+    // These match the colorspaces displayio_convert_color handles.
+    return colorspace->depth == 16 ||
+           colorspace->tricolor || colorspace->fourcolor ||
+           (colorspace->grayscale && colorspace->depth <= 8) ||
+           colorspace->depth == 32 || colorspace->depth == 24 ||
+           colorspace->depth == 8 || colorspace->depth == 4;
+}
+
+bool displayio_colorconverter_is_opaque(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    return self->transparent_color == NO_TRANSPARENT_COLOR && displayio_convert_color_is_opaque(colorspace);
+}
+
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
     return false;
@@ -25,7 +25,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint16_t cached_rows) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -158,6 +158,100 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    // Caching more rows than the image has is wasted RAM.
+    self->cached_rows = MIN(cached_rows, self->height);
+    self->row_use_count = 0;
+    self->row_cache = NULL;
+    self->cached_row = NULL;
+    if (self->cached_rows > 0) {
+        self->row_cache = m_malloc_without_collect(self->cached_rows * self->stride);
+        self->cached_row = m_malloc_without_collect(self->cached_rows * sizeof(displayio_ondiskbitmap_cached_row_t));
+        for (uint16_t i = 0; i < self->cached_rows; i++) {
+            self->cached_row[i].y = -1;
+            self->cached_row[i].last_used = 0;
+        }
+    }
+}
+
+// Decodes the little endian file data of the pixel at `x` into its value.
+static uint32_t _decode_pixel(displayio_ondiskbitmap_t *self, uint32_t pixel_data, int16_t x) {
+    uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
+    uint32_t tmp = 0;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    if (bytes_per_pixel == 1) {
+        uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
+        uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
+        uint8_t mask = (1 << self->bits_per_pixel) - 1;
+
+        return (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
+    } else if (bytes_per_pixel == 2) {
+        if (self->g_bitmask == 0x07e0) { // 565
+            red = ((pixel_data & self->r_bitmask) >> 11);
+            green = ((pixel_data & self->g_bitmask) >> 5);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        } else { // 555
+            red = ((pixel_data & self->r_bitmask) >> 10);
+            green = ((pixel_data & self->g_bitmask) >> 4);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        }
+        tmp = (red << 19 | green << 10 | blue << 3);
+        return tmp;
+    } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
+        return pixel_data & 0x00FFFFFF;
+    } else {
+        return pixel_data;
+    }
+}
+
+// Returns the raw file data for row `y`, reading it into the least recently used cache slot if it
+// isn't already cached. Returns NULL if the file can't be read.
+static const uint8_t *_get_cached_row(displayio_ondiskbitmap_t *self, int16_t y) {
+    uint16_t oldest = 0;
+    for (uint16_t i = 0; i < self->cached_rows; i++) {
+        displayio_ondiskbitmap_cached_row_t *cached = &self->cached_row[i];
+        if (cached->y == y) {
+            // Only count row changes so consecutive pixels of one row don't age the others.
+            if (cached->last_used != self->row_use_count) {
+                cached->last_used = ++self->row_use_count;
+            }
+            return self->row_cache + i * self->stride;
+        }
+        if (cached->last_used < self->cached_row[oldest].last_used) {
+            oldest = i;
+        }
+    }
+
+    uint8_t *data = self->row_cache + oldest * self->stride;
+    self->cached_row[oldest].y = -1;
+    uint32_t location = self->data_offset + (self->height - y - 1) * self->stride;
+    f_lseek(&self->file->fp, location);
+    UINT bytes_read;
+    if (f_read(&self->file->fp, data, self->stride, &bytes_read) != FR_OK) {
+        return NULL;
+    }
+    // A short final row reads as zeros, as it did when pixels were read one at a time.
+    memset(data + bytes_read, 0, self->stride - bytes_read);
+    self->cached_row[oldest].y = y;
+    self->cached_row[oldest].last_used = ++self->row_use_count;
+    return data;
+}
+
+static uint32_t _get_cached_pixel(displayio_ondiskbitmap_t *self, const uint8_t *row, int16_t x) {
+    uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
+    uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
+    const uint8_t *data;
+    if (pixels_per_byte == 0) {
+        data = row + x * bytes_per_pixel;
+    } else {
+        data = row + x / pixels_per_byte;
+    }
+    uint32_t pixel_data = 0;
+    for (uint8_t i = 0; i < bytes_per_pixel; i++) {
+        pixel_data |= data[i] << (8 * i);
+    }
+    return _decode_pixel(self, pixel_data, x);
 }
 
 
@@ -167,6 +261,14 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
         return 0;
     }
 
+    if (self->cached_rows > 0) {
+        const uint8_t *row = _get_cached_row(self, y);
+        if (row == NULL) {
+            return 0;
+        }
+        return _get_cached_pixel(self, row, x);
+    }
+
     uint32_t location;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
@@ -175,40 +277,32 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
+    // Without a row cache, rely on the underlying FS caching sectors.
     f_lseek(&self->file->fp, location);
     UINT bytes_read;
     uint32_t pixel_data = 0;
     uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
     if (result == FR_OK) {
-        uint32_t tmp = 0;
-        uint8_t red;
-        uint8_t green;
-        uint8_t blue;
-        if (bytes_per_pixel == 1) {
-            uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
-            uint8_t mask = (1 << self->bits_per_pixel) - 1;
-
-            return (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
-        } else if (bytes_per_pixel == 2) {
-            if (self->g_bitmask == 0x07e0) { // 565
-                red = ((pixel_data & self->r_bitmask) >> 11);
-                green = ((pixel_data & self->g_bitmask) >> 5);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            } else { // 555
-                red = ((pixel_data & self->r_bitmask) >> 10);
-                green = ((pixel_data & self->g_bitmask) >> 4);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            }
-            tmp = (red << 19 | green << 10 | blue << 3);
-            return tmp;
-        } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
-            return pixel_data & 0x00FFFFFF;
+        return _decode_pixel(self, pixel_data, x);
+    }
+    return 0;
+}
+
+void displayio_ondiskbitmap_get_row(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t length, uint32_t *values) {
+    const uint8_t *row = NULL;
+    if (self->cached_rows > 0 && y >= 0 && y < self->height) {
+        row = _get_cached_row(self, y);
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        int16_t pixel_x = x + i;
+        if (self->cached_rows == 0) {
+            values[i] = common_hal_displayio_ondiskbitmap_get_pixel(self, pixel_x, y);
+        } else if (row == NULL || pixel_x < 0 || pixel_x >= self->width) {
+            values[i] = 0;
         } else {
-            return pixel_data;
+            values[i] = _get_cached_pixel(self, row, pixel_x);
         }
     }
-    return 0;
 }
 
 uint16_t common_hal_displayio_ondiskbitmap_get_height(displayio_ondiskbitmap_t *self) {
@@ -13,6 +13,11 @@
 
 #include "extmod/vfs_fat.h"
 
+typedef struct {
+    uint32_t last_used;
+    int16_t y; // -1 when the slot is empty.
+} displayio_ondiskbitmap_cached_row_t;
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -28,6 +33,13 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    uint8_t *row_cache; // cached_rows * stride bytes of raw row data.
+    displayio_ondiskbitmap_cached_row_t *cached_row;
+    uint32_t row_use_count;
+    uint16_t cached_rows;
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
+
+// Reads `length` decoded values of row `y` starting at `x` into `values`. Out of range values are 0.
+void displayio_ondiskbitmap_get_row(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t length, uint32_t *values);
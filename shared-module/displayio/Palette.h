@@ -41,7 +41,7 @@ typedef struct {
     uint32_t pixel;
     uint16_t x;
     uint16_t y;
-    uint8_t tile;
+    uint16_t tile;
     uint16_t tile_x;
     uint16_t tile_y;
 } displayio_input_pixel_t;
@@ -55,6 +55,7 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    uint32_t transparent_count;
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
@@ -62,5 +63,7 @@ typedef struct displayio_palette {
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
 ;
+// True when values below value_count all map to opaque pixels in the given colorspace.
+bool displayio_palette_is_opaque(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, uint32_t value_count);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
@@ -425,6 +425,199 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+static inline uint32_t _bitmap_row_get(const displayio_bitmap_t *bitmap, const uint32_t *row, int16_t x) {
+    switch (bitmap->bits_per_value) {
+        case 8:
+            return ((const uint8_t *)row)[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 32:
+            return row[x];
+        default: {
+            uint8_t bits = ((const uint8_t *)row)[x >> bitmap->x_shift];
+            uint8_t values_per_byte = 8 / bitmap->bits_per_value;
+            uint8_t bit_position = (values_per_byte - (x & bitmap->x_mask) - 1) * bitmap->bits_per_value;
+            return (bits >> bit_position) & bitmap->bitmask;
+        }
+    }
+}
+
+static inline void _store_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint32_t offset, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        *(((uint16_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 32) {
+        *(((uint32_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 24) {
+        memcpy(((uint8_t *)buffer) + offset * 3, &pixel, 3);
+    } else if (colorspace->depth == 8) {
+        *(((uint8_t *)buffer) + offset) = pixel;
+    }
+}
+
+// State shared by all spans of one fill so the last color lookup can be reused across spans.
+typedef struct {
+    displayio_bitmap_t *bitmap; // NULL when reading from ondiskbitmap.
+    displayio_ondiskbitmap_t *ondiskbitmap;
+    // Both NULL when the bitmap values are the output pixels.
+    displayio_palette_t *palette;
+    displayio_colorconverter_t *colorconverter;
+    const _displayio_colorspace_t *colorspace;
+    uint32_t *mask;
+    uint32_t *buffer;
+    displayio_input_pixel_t input_pixel;
+    displayio_output_pixel_t output_pixel;
+    bool output_valid;
+} displayio_tilegrid_span_t;
+
+// Renders `length` consecutive pixels of bitmap row `y`, starting at `x`, into consecutive
+// buffer offsets starting at `offset`. The mask is tested and updated one word at a time.
+// Returns false if any pixel that wasn't already masked is transparent.
+static bool _fill_span(displayio_tilegrid_span_t *span, int16_t x, int16_t y, uint16_t length, uint32_t offset) {
+    displayio_bitmap_t *bitmap = span->bitmap;
+    const uint32_t *row = NULL;
+    if (bitmap != NULL && y >= 0 && y < bitmap->height && x >= 0 && x + length <= bitmap->width) {
+        row = bitmap->data + y * bitmap->stride;
+    }
+    // Without a shader, values can be copied straight into the buffer when the depths match.
+    uint8_t depth = span->colorspace->depth;
+    bool shaded = span->palette != NULL || span->colorconverter != NULL;
+    bool direct = !shaded && row != NULL && bitmap->bits_per_value == depth &&
+        (depth == 8 || depth == 16 || depth == 32);
+    uint32_t file_values[32];
+
+    bool opaque = true;
+    uint16_t i = 0;
+    while (i < length) {
+        uint32_t bit = (offset + i) % 32;
+        uint16_t chunk = MIN(32 - bit, (uint32_t)(length - i));
+        uint32_t chunk_mask = (chunk == 32 ? 0xffffffff : ((1u << chunk) - 1)) << bit;
+        uint32_t *mask_word = &span->mask[(offset + i) / 32];
+        uint32_t already_set = *mask_word & chunk_mask;
+        if (already_set == chunk_mask) {
+            i += chunk;
+            continue;
+        }
+        if (direct && already_set == 0) {
+            uint8_t bytes_per_pixel = depth / 8;
+            memcpy(((uint8_t *)span->buffer) + (offset + i) * bytes_per_pixel,
+                ((const uint8_t *)row) + (x + i) * bytes_per_pixel, chunk * bytes_per_pixel);
+            *mask_word |= chunk_mask;
+            i += chunk;
+            continue;
+        }
+        if (bitmap == NULL) {
+            // Read the whole chunk at once so the file is only touched once per row.
+            displayio_ondiskbitmap_get_row(span->ondiskbitmap, x + i, y, chunk, file_values);
+        }
+        uint32_t newly_set = 0;
+        for (uint16_t j = 0; j < chunk; j++, i++) {
+            uint32_t pixel_bit = 1u << (bit + j);
+            if ((already_set & pixel_bit) != 0) {
+                continue;
+            }
+            uint32_t value;
+            if (bitmap == NULL) {
+                value = file_values[j];
+            } else if (row != NULL) {
+                value = _bitmap_row_get(bitmap, row, x + i);
+            } else {
+                value = common_hal_displayio_bitmap_get_pixel(bitmap, x + i, y);
+            }
+            if (shaded) {
+                // Runs of the same value are common so reuse the last lookup.
+                if (!span->output_valid || span->input_pixel.pixel != value) {
+                    span->input_pixel.pixel = value;
+                    span->output_pixel.opaque = true;
+                    if (span->palette != NULL) {
+                        displayio_palette_get_color(span->palette, span->colorspace, &span->input_pixel, &span->output_pixel);
+                    } else {
+                        displayio_colorconverter_convert(span->colorconverter, span->colorspace, &span->input_pixel, &span->output_pixel);
+                    }
+                    span->output_valid = true;
+                }
+                if (!span->output_pixel.opaque) {
+                    opaque = false;
+                    continue;
+                }
+                value = span->output_pixel.pixel;
+            }
+            _store_pixel(span->colorspace, span->buffer, offset + i, value);
+            newly_set |= pixel_bit;
+        }
+        *mask_word |= newly_set;
+    }
+    return opaque;
+}
+
+// Returns true if every mask bit in [start, start + length) is set.
+static bool _mask_is_set(const uint32_t *mask, uint32_t start, uint32_t length) {
+    uint32_t end = start + length;
+    while (start < end) {
+        uint32_t bit = start % 32;
+        uint32_t chunk = MIN(32 - bit, end - start);
+        uint32_t chunk_mask = (chunk == 32 ? 0xffffffff : ((1u << chunk) - 1)) << bit;
+        if ((mask[start / 32] & chunk_mask) != chunk_mask) {
+            return false;
+        }
+        start += chunk;
+    }
+    return true;
+}
+
+static void _mask_set(uint32_t *mask, uint32_t start, uint32_t length) {
+    uint32_t end = start + length;
+    while (start < end) {
+        uint32_t bit = start % 32;
+        uint32_t chunk = MIN(32 - bit, end - start);
+        mask[start / 32] |= (chunk == 32 ? 0xffffffff : ((1u << chunk) - 1)) << bit;
+        start += chunk;
+    }
+}
+
+// Returns true if every pixel of area outside of overlap is already set in the mask.
+static bool _mask_is_set_outside(const uint32_t *mask, const displayio_area_t *area, const displayio_area_t *overlap) {
+    uint16_t width = displayio_area_width(area);
+    if (!_mask_is_set(mask, 0, (overlap->y1 - area->y1) * width)) {
+        return false;
+    }
+    for (int16_t y = overlap->y1; y < overlap->y2; y++) {
+        uint32_t row_start = (y - area->y1) * width;
+        if (!_mask_is_set(mask, row_start, overlap->x1 - area->x1) ||
+            !_mask_is_set(mask, row_start + (overlap->x2 - area->x1), area->x2 - overlap->x2)) {
+            return false;
+        }
+    }
+    uint32_t below = (overlap->y2 - area->y1) * width;
+    return _mask_is_set(mask, below, displayio_area_size(area) - below);
+}
+
+// Returns true when every value the bitmap can hold renders as an opaque pixel.
+static bool _is_opaque(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace,
+    bool is_bitmap, bool is_ondiskbitmap, bool is_palette, bool is_colorconverter) {
+    if (self->pixel_shader == mp_const_none) {
+        return true;
+    }
+    if (is_colorconverter) {
+        return displayio_colorconverter_is_opaque(self->pixel_shader, colorspace);
+    }
+    if (!is_palette) {
+        return false;
+    }
+    uint8_t bits_per_value;
+    if (is_bitmap) {
+        bits_per_value = ((displayio_bitmap_t *)MP_OBJ_TO_PTR(self->bitmap))->bits_per_value;
+    } else if (is_ondiskbitmap) {
+        bits_per_value = ((displayio_ondiskbitmap_t *)MP_OBJ_TO_PTR(self->bitmap))->bits_per_pixel;
+    } else {
+        return false;
+    }
+    // Palettes are never large enough to cover every value of a wider bitmap.
+    if (bits_per_value > 16) {
+        return false;
+    }
+    return displayio_palette_is_opaque(self->pixel_shader, colorspace, 1u << bits_per_value);
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -473,11 +666,24 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
+    // Resolve the bitmap and pixel shader types once rather than per pixel.
+    bool is_bitmap = mp_obj_is_type(self->bitmap, &displayio_bitmap_type);
+    bool is_ondiskbitmap = mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type);
+    bool is_palette = mp_obj_is_type(self->pixel_shader, &displayio_palette_type);
+    bool is_colorconverter = mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type);
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    bool is_tilepalettemapper = mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type);
+    #endif
+
+    // An opaque layer also finishes the area when everything outside of it has already been set.
+    bool opaque = _is_opaque(self, colorspace, is_bitmap, is_ondiskbitmap, is_palette, is_colorconverter);
+    if (opaque && !full_coverage) {
+        full_coverage = _mask_is_set_outside(mask, area, &overlap);
+    }
+    // When we're opaque and finish the area, no lower layer will test the mask so it can be set
+    // in bulk once we're done instead of per pixel.
+    bool bulk_mask = opaque && full_coverage;
 
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
     displayio_area_t transformed;
     displayio_area_transform_within(flip_x != (self->absolute_transform->dx < 0), flip_y != (self->absolute_transform->dy < 0), self->transpose_xy != self->absolute_transform->transpose_xy,
         &overlap,
@@ -512,6 +718,55 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    // Unscaled, unmirrored and untransposed bitmaps map each tile row onto consecutive buffer
+    // pixels so render them a span at a time. Dithering shaders depend on the pixel location so
+    // they take the per-pixel path.
+    if ((is_bitmap || is_ondiskbitmap) &&
+        self->absolute_transform->scale == 1 &&
+        x_stride == 1 &&
+        self->transpose_xy == self->absolute_transform->transpose_xy &&
+        colorspace->depth >= 8 &&
+        (self->pixel_shader == mp_const_none ||
+         (is_palette && !((displayio_palette_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither) ||
+         (is_colorconverter && !((displayio_colorconverter_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither))) {
+        displayio_tilegrid_span_t span = {
+            .bitmap = is_bitmap ? self->bitmap : NULL,
+            .ondiskbitmap = is_ondiskbitmap ? self->bitmap : NULL,
+            .palette = is_palette ? self->pixel_shader : NULL,
+            .colorconverter = is_colorconverter ? self->pixel_shader : NULL,
+            .colorspace = colorspace,
+            .mask = mask,
+            .buffer = buffer,
+            .output_valid = false,
+        };
+        for (int16_t y = start_y; y < end_y; ++y) {
+            int16_t row_start = start + (y - start_y + y_shift) * y_stride; // in pixels
+            uint16_t y_tile_index = (y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+            int16_t tile_row = y % self->tile_height;
+            int16_t x = start_x;
+            while (x < end_x) {
+                uint16_t x_tile_index = (x / self->tile_width + self->top_left_x) % self->width_in_tiles;
+                int16_t tile_column = x % self->tile_width;
+                uint16_t run = MIN(self->tile_width - tile_column, end_x - x);
+                uint16_t tile_location = y_tile_index * self->width_in_tiles + x_tile_index;
+                uint16_t tile;
+                if (self->tiles_in_bitmap > 255) {
+                    tile = ((uint16_t *)tiles)[tile_location];
+                } else {
+                    tile = ((uint8_t *)tiles)[tile_location];
+                }
+                int16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + tile_column;
+                int16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + tile_row;
+                uint32_t offset = row_start + (x - start_x + x_shift); // in pixels
+                if (!_fill_span(&span, tile_x, tile_y, run, offset)) {
+                    full_coverage = false;
+                }
+                x += run;
+            }
+        }
+        return full_coverage;
+    }
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
@@ -549,30 +804,32 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
 
             // We always want to read bitmap pixels by row first and then transpose into the destination
             // buffer because most bitmaps are row associated.
-            if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+            if (is_bitmap) {
                 input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
+            } else if (is_ondiskbitmap) {
                 input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
             }
 
             output_pixel.opaque = true;
             #if CIRCUITPY_TILEPALETTEMAPPER
-            if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
+            if (is_tilepalettemapper) {
                 tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel, x_tile_index, y_tile_index);
             }
             #endif
             if (self->pixel_shader == mp_const_none) {
                 output_pixel.pixel = input_pixel.pixel;
-            } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+            } else if (is_palette) {
                 displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-            } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+            } else if (is_colorconverter) {
                 displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
             }
             if (!output_pixel.opaque) {
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
+                if (!bulk_mask) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
                 if (colorspace->depth == 16) {
                     *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
                 } else if (colorspace->depth == 32) {
@@ -606,6 +863,9 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             }
         }
     }
+    if (bulk_mask) {
+        _mask_set(mask, 0, displayio_area_size(area));
+    }
     return full_coverage;
 }
 
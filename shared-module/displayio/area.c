@@ -139,3 +139,34 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Merges areas in place and returns the new count. Pairs are merged cheapest first while the union
+// costs no more than the pair, counting area_cost pixels of overhead per area. Merging then continues
+// regardless of cost until no more than limit areas remain. The next pointers are not updated.
+size_t displayio_area_coalesce(displayio_area_t *areas, size_t count, size_t limit, uint32_t area_cost) {
+    while (count > 1) {
+        size_t best_a = 0;
+        size_t best_b = 1;
+        int32_t best_cost = INT32_MAX;
+        for (size_t a = 0; a < count - 1; a++) {
+            for (size_t b = a + 1; b < count; b++) {
+                displayio_area_t u;
+                displayio_area_union(&areas[a], &areas[b], &u);
+                int32_t cost = (int32_t)displayio_area_size(&u) -
+                    (int32_t)displayio_area_size(&areas[a]) - (int32_t)displayio_area_size(&areas[b]);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_a = a;
+                    best_b = b;
+                }
+            }
+        }
+        if (count <= limit && best_cost > (int32_t)area_cost) {
+            break;
+        }
+        displayio_area_union(&areas[best_a], &areas[best_b], &areas[best_a]);
+        count--;
+        displayio_area_copy(&areas[count], &areas[best_b]);
+    }
+    return count;
+}
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -55,3 +56,4 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
     const displayio_area_t *original,
     const displayio_area_t *whole,
     displayio_area_t *transformed);
+size_t displayio_area_coalesce(displayio_area_t *areas, size_t count, size_t limit, uint32_t area_cost);
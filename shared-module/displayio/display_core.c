@@ -33,6 +33,7 @@ void displayio_display_core_construct(displayio_display_core_t *self,
     self->colorspace.dither = false;
     self->current_group = NULL;
     self->last_refresh = 0;
+    memset(&self->refresh_stats, 0, sizeof(self->refresh_stats));
 
     supervisor_start_terminal(width, height);
 
@@ -203,3 +204,52 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// Clips the linked list of dirty areas to the display and merges them into a list of at most
+// CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT areas that cost less to send. The returned list is valid
+// until the next call.
+const displayio_area_t *displayio_display_core_plan_refresh_areas(displayio_display_core_t *self, const displayio_area_t *areas) {
+    displayio_display_core_refresh_stats_t *stats = &self->refresh_stats;
+    memset(stats, 0, sizeof(*stats));
+
+    size_t count = 0;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        displayio_area_t clipped;
+        if (!displayio_display_core_clip_area(self, area, &clipped)) {
+            continue;
+        }
+        stats->areas_requested++;
+        stats->pixels_requested += displayio_area_size(&clipped);
+        if (count == CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT) {
+            // Make room by merging what we have so far.
+            count = displayio_area_coalesce(self->refresh_areas, count,
+                CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT - 1, CIRCUITPY_DISPLAY_REFRESH_AREA_COST);
+        }
+        displayio_area_copy(&clipped, &self->refresh_areas[count]);
+        count++;
+    }
+    count = displayio_area_coalesce(self->refresh_areas, count,
+        CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT, CIRCUITPY_DISPLAY_REFRESH_AREA_COST);
+
+    stats->areas_refreshed = count;
+    for (size_t i = 0; i < count; i++) {
+        stats->pixels_refreshed += displayio_area_size(&self->refresh_areas[i]);
+        self->refresh_areas[i].next = i + 1 < count ? &self->refresh_areas[i + 1] : NULL;
+    }
+    DISPLAYIO_CORE_DEBUG("refresh areas %d -> %d, pixels %d -> %d\n", stats->areas_requested, stats->areas_refreshed,
+        stats->pixels_requested, stats->pixels_refreshed);
+    return count > 0 ? &self->refresh_areas[0] : NULL;
+}
+
+// Returns the stats of the most recent refresh as a tuple of
+// (pixels_requested, pixels_refreshed, areas_requested, areas_refreshed).
+mp_obj_t displayio_display_core_get_refresh_stats(displayio_display_core_t *self) {
+    const displayio_display_core_refresh_stats_t *stats = &self->refresh_stats;
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(stats->pixels_requested),
+        mp_obj_new_int_from_uint(stats->pixels_refreshed),
+        MP_OBJ_NEW_SMALL_INT(stats->areas_requested),
+        MP_OBJ_NEW_SMALL_INT(stats->areas_refreshed),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
@@ -13,6 +13,14 @@
 
 #define NO_COMMAND 0x100
 
+// Counts for the most recent refresh. pixels_refreshed / pixels_requested is the overdraw ratio.
+typedef struct {
+    uint32_t pixels_requested; // Dirty pixels on the display. Overlapping areas count each time.
+    uint32_t pixels_refreshed; // Pixels sent after merging areas.
+    uint16_t areas_requested;
+    uint16_t areas_refreshed;
+} displayio_display_core_refresh_stats_t;
+
 typedef struct {
     displayio_group_t *current_group;
     uint64_t last_refresh;
@@ -22,6 +30,8 @@ typedef struct {
     uint16_t height;
     uint16_t rotation;
     _displayio_colorspace_t colorspace;
+    displayio_area_t refresh_areas[CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT];
+    displayio_display_core_refresh_stats_t refresh_stats;
 
     bool full_refresh; // New group means we need to refresh the whole display.
     bool refresh_in_progress;
@@ -51,3 +61,6 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
+
+const displayio_area_t *displayio_display_core_plan_refresh_areas(displayio_display_core_t *self, const displayio_area_t *areas);
+mp_obj_t displayio_display_core_get_refresh_stats(displayio_display_core_t *self);
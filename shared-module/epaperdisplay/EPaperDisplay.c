@@ -119,7 +119,7 @@ static const displayio_area_t *epaperdisplay_epaperdisplay_get_refresh_areas(epa
         self->core.area.next = NULL;
         return &self->core.area;
     }
-    return first_area;
+    return displayio_display_core_plan_refresh_areas(&self->core, first_area);
 }
 
 uint16_t common_hal_epaperdisplay_epaperdisplay_get_width(epaperdisplay_epaperdisplay_obj_t *self) {
@@ -130,6 +130,10 @@ uint16_t common_hal_epaperdisplay_epaperdisplay_get_height(epaperdisplay_epaperd
     return displayio_display_core_get_height(&self->core);
 }
 
+mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_refresh_stats(epaperdisplay_epaperdisplay_obj_t *self) {
+    return displayio_display_core_get_refresh_stats(&self->core);
+}
+
 static void wait_for_busy(epaperdisplay_epaperdisplay_obj_t *self) {
     if (self->busy.base.type == &mp_type_NoneType) {
         return;
@@ -85,6 +85,10 @@ uint16_t common_hal_framebufferio_framebufferdisplay_get_height(framebufferio_fr
     return displayio_display_core_get_height(&self->core);
 }
 
+mp_obj_t common_hal_framebufferio_framebufferdisplay_get_refresh_stats(framebufferio_framebufferdisplay_obj_t *self) {
+    return displayio_display_core_get_refresh_stats(&self->core);
+}
+
 mp_float_t common_hal_framebufferio_framebufferdisplay_get_brightness(framebufferio_framebufferdisplay_obj_t *self) {
     if (self->framebuffer_protocol->get_brightness) {
         return self->framebuffer_protocol->get_brightness(self->framebuffer);
@@ -108,9 +112,10 @@ mp_obj_t common_hal_framebufferio_framebufferdisplay_get_framebuffer(framebuffer
 static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
-        return &self->core.area;
+        return displayio_display_core_plan_refresh_areas(&self->core, &self->core.area);
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        const displayio_area_t *dirty_areas = displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_display_core_plan_refresh_areas(&self->core, dirty_areas);
     }
     return NULL;
 }
@@ -135,6 +135,7 @@ const char *common_hal_os_path_abspath(const char *path) {
 }
 
 void common_hal_os_chdir(const char *path) {
+    mp_vfs_import_cache_invalidate();
     MP_STATE_VM(cwd_path) = common_hal_os_path_abspath(path);
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(MP_STATE_VM(cwd_path), &path_out);
@@ -191,6 +192,7 @@ mp_obj_t common_hal_os_listdir(const char *path) {
 }
 
 void common_hal_os_mkdir(const char *path) {
+    mp_vfs_import_cache_invalidate();
     const char *abspath = common_hal_os_path_abspath(path);
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(abspath, &path_out);
@@ -201,6 +203,7 @@ void common_hal_os_mkdir(const char *path) {
 }
 
 void common_hal_os_remove(const char *path) {
+    mp_vfs_import_cache_invalidate();
     const char *abspath = common_hal_os_path_abspath(path);
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(abspath, &path_out);
@@ -208,6 +211,7 @@ void common_hal_os_remove(const char *path) {
 }
 
 void common_hal_os_rename(const char *old_path, const char *new_path) {
+    mp_vfs_import_cache_invalidate();
     mp_obj_t args[2];
     mp_vfs_mount_t *old_vfs = lookup_path(old_path, &args[0]);
     mp_vfs_mount_t *new_vfs = lookup_path(new_path, &args[1]);
@@ -219,6 +223,7 @@ void common_hal_os_rename(const char *old_path, const char *new_path) {
 }
 
 void common_hal_os_rmdir(const char *path) {
+    mp_vfs_import_cache_invalidate();
     const char *abspath = common_hal_os_path_abspath(path);
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(abspath, &path_out);
@@ -59,6 +59,7 @@ void automount_sd_card(void) {
                 }
             }
             _sdcard_vfs.next = NULL;
+            mp_vfs_import_cache_invalidate();
 
             #ifdef DEFAULT_SD_MOSI
             common_hal_busio_spi_deinit(&busio_spi_obj);
@@ -122,6 +123,7 @@ void automount_sd_card(void) {
     sdcard_vfs->obj = MP_OBJ_FROM_PTR(&_sdcard_usermount);
     sdcard_vfs->next = MP_STATE_VM(vfs_mount_table);
     MP_STATE_VM(vfs_mount_table) = sdcard_vfs;
+    mp_vfs_import_cache_invalidate();
     _automounted = true;
     #endif // DEFAULT_SD_CARD_DETECT
 }
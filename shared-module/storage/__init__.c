@@ -82,6 +82,7 @@ static mp_obj_t mp_vfs_proxy_call(mp_vfs_mount_t *vfs, qstr meth_name, size_t n_
 }
 
 void common_hal_storage_mount(mp_obj_t vfs_obj, const char *mount_path, bool readonly) {
+    mp_vfs_import_cache_invalidate();
     const char *abs_mount_path = common_hal_os_path_abspath(mount_path);
     // create new object
     mp_vfs_mount_t *vfs = m_new_obj(mp_vfs_mount_t);
@@ -126,10 +127,12 @@ void common_hal_storage_mount(mp_obj_t vfs_obj, const char *mount_path, bool rea
     // call the underlying object to do any mounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_mount, 2, (mp_obj_t *)&args);
 
-    fs_user_mount_t *vfs_fat = MP_OBJ_TO_PTR(vfs_obj);
-    // Filesystem is read-only to USB if writable by CircuitPython, and vice versa.
-    filesystem_set_writable_by_usb(vfs_fat, readonly);
-    filesystem_set_concurrent_write_protection(vfs_fat, true);
+    if (mp_obj_is_type(vfs_obj, &mp_fat_vfs_type)) {
+        fs_user_mount_t *vfs_fat = MP_OBJ_TO_PTR(vfs_obj);
+        // Filesystem is read-only to USB if writable by CircuitPython, and vice versa.
+        filesystem_set_writable_by_usb(vfs_fat, readonly);
+        filesystem_set_concurrent_write_protection(vfs_fat, true);
+    }
 
     // Insert the vfs into the mount table by pushing it onto the front of the
     // mount table.
@@ -139,6 +142,7 @@ void common_hal_storage_mount(mp_obj_t vfs_obj, const char *mount_path, bool rea
 }
 
 void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
+    mp_vfs_import_cache_invalidate();
     // remove vfs from the mount table
     mp_vfs_mount_t *vfs = NULL;
     for (mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table); *vfsp != NULL; vfsp = &(*vfsp)->next) {
@@ -184,7 +188,7 @@ void common_hal_storage_remount(const char *mount_path, bool readonly, bool disa
     const char *path_under_mount;
     const char *abs_mount_path = common_hal_os_path_abspath(mount_path);
     fs_user_mount_t *fs_usermount = filesystem_for_path(abs_mount_path, &path_under_mount);
-    if (path_under_mount[0] != 0 && strcmp(abs_mount_path, "/") != 0) {
+    if (fs_usermount == NULL || (path_under_mount[0] != 0 && strcmp(abs_mount_path, "/") != 0)) {
         mp_raise_OSError(MP_EINVAL);
     }
 
@@ -0,0 +1,94 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/synthio/__init__.h"
+#include "shared-module/synthio/BandlimitedWaveform.h"
+
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// Each level is made from the one before by a half-band low-pass filter,
+// keeping every other sample. Besides the centre tap of 1/2, only odd taps of a
+// half-band filter are non-zero; these are taps +-1, +-3, ... +-(2 * HALFBAND_TAPS - 1).
+#define HALFBAND_TAPS (8)
+#define HALFBAND_SHIFT (14)
+
+static void halfband_taps(int32_t *taps) {
+    // Blackman windowed sinc with its cutoff at a quarter of the sample rate,
+    // scaled so the taps add up to 1 and DC is passed unchanged.
+    mp_float_t h[HALFBAND_TAPS];
+    mp_float_t sum = 0;
+    mp_float_t half_width = 2 * HALFBAND_TAPS;
+    for (int t = 0; t < HALFBAND_TAPS; t++) {
+        int j = 2 * t + 1;
+        mp_float_t window = MICROPY_FLOAT_CONST(0.42)
+            + MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(MP_PI * j / half_width)
+            + MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(2 * MP_PI * j / half_width);
+        h[t] = MICROPY_FLOAT_C_FUN(sin)(MP_PI * j / 2) / (MP_PI * j) * window;
+        sum += h[t];
+    }
+    for (int t = 0; t < HALFBAND_TAPS; t++) {
+        taps[t] = (int32_t)MICROPY_FLOAT_C_FUN(round)(h[t] / (4 * sum) * (1 << HALFBAND_SHIFT));
+    }
+}
+
+// Filter the periodic waveform src of length len into dst of length len / 2
+static void halfband_decimate(int16_t *dst, const int16_t *src, size_t len, const int32_t *taps) {
+    for (size_t n = 0; n < len / 2; n++) {
+        size_t centre = 2 * n;
+        int32_t acc = (int32_t)src[centre] << (HALFBAND_SHIFT - 1);
+        for (int t = 0; t < HALFBAND_TAPS; t++) {
+            size_t j = (2 * t + 1) % len;
+            size_t before = (centre + len - j) % len;
+            size_t after = (centre + j) % len;
+            acc += taps[t] * (src[before] + src[after]);
+        }
+        dst[n] = synthio_sat16(acc + (1 << (HALFBAND_SHIFT - 1)), HALFBAND_SHIFT);
+    }
+}
+
+void common_hal_synthio_bandlimited_waveform_construct(synthio_bandlimited_waveform_obj_t *self, const mp_buffer_info_t *bufinfo) {
+    uint32_t length = bufinfo->len;
+    uint8_t levels = 1;
+    while ((length >> (levels - 1)) % 2 == 0 && (length >> levels) >= SYNTHIO_BANDLIMITED_MIN_LENGTH) {
+        levels++;
+    }
+
+    // The waveform has no pointers, so it doesn't need to be scanned by the gc
+    self->data = m_malloc_without_collect((2 * length - (2 * length >> levels)) * sizeof(int16_t));
+    self->length = length;
+    self->levels = levels;
+
+    memcpy(self->data, bufinfo->buf, length * sizeof(int16_t));
+
+    int32_t taps[HALFBAND_TAPS];
+    halfband_taps(taps);
+    const int16_t *src = self->data;
+    for (uint8_t level = 1; level < levels; level++) {
+        int16_t *dst = self->data + 2 * length - (2 * length >> level);
+        halfband_decimate(dst, src, length >> (level - 1), taps);
+        src = dst;
+    }
+}
+
+mp_int_t common_hal_synthio_bandlimited_waveform_get_levels(synthio_bandlimited_waveform_obj_t *self) {
+    return self->levels;
+}
+
+uint8_t synthio_bandlimited_waveform_level(const synthio_bandlimited_waveform_obj_t *self, uint32_t dds_rate, const int16_t **level_data) {
+    // At level k the waveform advances dds_rate >> k samples per output
+    // sample, and holds harmonics up to half its length. These are all below
+    // the Nyquist frequency once it advances at most one sample at a time.
+    uint8_t level = 0;
+    while (level + 1 < self->levels && (dds_rate >> level) > (1u << SYNTHIO_FREQUENCY_SHIFT)) {
+        level++;
+    }
+    *level_data = self->data + 2 * self->length - (2 * self->length >> level);
+    return level;
+}
@@ -0,0 +1,26 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-bindings/synthio/BandlimitedWaveform.h"
+
+// Levels stop before their length would drop below this, or become odd
+#define SYNTHIO_BANDLIMITED_MIN_LENGTH (4)
+
+typedef struct synthio_bandlimited_waveform_obj {
+    mp_obj_base_t base;
+    // level k is length >> k samples long and starts at
+    // data + 2 * length - (2 * length >> k)
+    int16_t *data;
+    uint32_t length;
+    uint8_t levels;
+} synthio_bandlimited_waveform_obj_t;
+
+// Pick the level to play the waveform at dds_rate (in samples of level 0, with
+// SYNTHIO_FREQUENCY_SHIFT fractional bits), so that no harmonic it holds is
+// above the Nyquist frequency. Returns the level and sets *level_data to it.
+uint8_t synthio_bandlimited_waveform_level(const synthio_bandlimited_waveform_obj_t *self, uint32_t dds_rate, const int16_t **level_data);
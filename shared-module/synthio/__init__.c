@@ -8,6 +8,7 @@
 #include "shared-module/synthio/__init__.h"
 #include "shared-bindings/audiocore/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
+#include "shared-module/synthio/BandlimitedWaveform.h"
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/Note.h"
 #include "py/runtime.h"
@@ -24,27 +25,6 @@ static const int16_t square_wave[] = {-32768, 32767};
 static const uint16_t notes[] = {8372, 8870, 9397, 9956, 10548, 11175, 11840,
                                  12544, 13290, 14080, 14917, 15804}; // 9th octave
 
-// cleaner sat16 by http://www.moseleyinstruments.com/
-int16_t synthio_sat16(int32_t n, int rshift) {
-    // we should always round towards 0
-    // to avoid recirculating round-off noise
-    //
-    // a 2s complement positive number is always
-    // rounded down, so we only need to take
-    // care of negative numbers
-    if (n < 0) {
-        n = n + (~(0xFFFFFFFFUL << rshift));
-    }
-    n = n >> rshift;
-    if (n > 32767) {
-        return 32767;
-    }
-    if (n < -32768) {
-        return -32768;
-    }
-    return n;
-}
-
 static int64_t round_float_to_int64(mp_float_t f) {
     return (int64_t)(f + MICROPY_FLOAT_CONST(0.5));
 }
@@ -171,6 +151,34 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
+static const synthio_bandlimited_waveform_obj_t *synthio_get_bandlimited(mp_obj_t waveform_obj) {
+    if (mp_obj_is_type(waveform_obj, &synthio_bandlimited_waveform_type)) {
+        return MP_OBJ_TO_PTR(waveform_obj);
+    }
+    return NULL;
+}
+
+// Fractional bits of the position used to interpolate. The difference between
+// two samples times a fraction of this many bits still fits in an int32_t.
+#define SYNTHIO_INTERPOLATE_BITS (15)
+
+// Read a band-limited waveform at accum, which is in units of the original
+// waveform, linearly interpolating between the samples of the chosen level
+static inline int16_t synthio_bandlimited_sample(const int16_t *level_data, uint8_t level, uint32_t accum, uint32_t start, uint32_t end) {
+    MP_STATIC_ASSERT(SYNTHIO_FREQUENCY_SHIFT >= SYNTHIO_INTERPOLATE_BITS);
+    uint32_t pos = accum >> level;
+    uint32_t idx = pos >> SYNTHIO_FREQUENCY_SHIFT;
+    if (idx >= end) {
+        idx = start;
+    }
+    uint32_t next = idx + 1;
+    if (next >= end) {
+        next = start;
+    }
+    int32_t frac = (pos >> (SYNTHIO_FREQUENCY_SHIFT - SYNTHIO_INTERPOLATE_BITS)) & ((1 << SYNTHIO_INTERPOLATE_BITS) - 1);
+    return level_data[idx] + (((level_data[next] - level_data[idx]) * frac) >> SYNTHIO_INTERPOLATE_BITS);
+}
+
 static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
@@ -181,9 +189,11 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     const int16_t *waveform = synth->waveform_bufinfo.buf;
     uint32_t waveform_start = 0;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
+    const synthio_bandlimited_waveform_obj_t *bandlimited = synthio_get_bandlimited(synth->waveform_obj);
 
     uint32_t ring_dds_rate = 0;
     const int16_t *ring_waveform = NULL;
+    const synthio_bandlimited_waveform_obj_t *ring_bandlimited = NULL;
     uint32_t ring_waveform_start = 0;
     uint32_t ring_waveform_length = 0;
 
@@ -203,6 +213,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         if (note->waveform_buf.buf) {
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
+            bandlimited = synthio_get_bandlimited(note->waveform_obj);
             waveform_start = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_start, 0, waveform_length - 1);
             waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_end, waveform_start + 1, waveform_length);
         }
@@ -210,6 +221,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
             ring_waveform_length = note->ring_waveform_buf.len;
+            ring_bandlimited = synthio_get_bandlimited(note->ring_waveform_obj);
             ring_waveform_start = (uint32_t)synthio_block_slot_get_limited(&note->ring_waveform_loop_start, 0, ring_waveform_length - 1);
             ring_waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->ring_waveform_loop_end, ring_waveform_start + 1, ring_waveform_length);
             ring_dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)note->ring_frequency_bent * (ring_waveform_length - ring_waveform_start), sample_rate);
@@ -235,14 +247,28 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     }
 
     // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-        if (accum > lim) {
-            accum = accum - lim + offset;
+    if (bandlimited) {
+        const int16_t *level_data;
+        uint8_t level = synthio_bandlimited_waveform_level(bandlimited, dds_rate, &level_data);
+        uint32_t start = waveform_start >> level;
+        uint32_t end = (waveform_length + (1 << level) - 1) >> level;
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            out_buffer32[i] = synthio_bandlimited_sample(level_data, level, accum, start, end);
+        }
+    } else {
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+            out_buffer32[i] = waveform[idx];
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
     }
     synth->accum[chan] = accum;
 
@@ -263,15 +289,30 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             accum = accum % lim + offset;
         }
 
-        for (uint16_t i = 0; i < dur; i++) {
-            accum += ring_dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum = accum - lim + offset;
+        if (ring_bandlimited) {
+            const int16_t *level_data;
+            uint8_t level = synthio_bandlimited_waveform_level(ring_bandlimited, ring_dds_rate, &level_data);
+            uint32_t start = ring_waveform_start >> level;
+            uint32_t end = (ring_waveform_length + (1 << level) - 1) >> level;
+            for (uint16_t i = 0; i < dur; i++) {
+                accum += ring_dds_rate;
+                if (accum > lim) {
+                    accum = accum - lim + offset;
+                }
+                int16_t wi = (synthio_bandlimited_sample(level_data, level, accum, start, end) * out_buffer32[i]) / 32768;
+                out_buffer32[i] = wi;
+            }
+        } else {
+            for (uint16_t i = 0; i < dur; i++) {
+                accum += ring_dds_rate;
+                // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+                if (accum > lim) {
+                    accum = accum - lim + offset;
+                }
+                int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+                int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768; // consider for synthio_sat16 but had a weird artificat
+                out_buffer32[i] = wi;
             }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768; // consider for synthio_sat16 but had a weird artificat
-            out_buffer32[i] = wi;
         }
         synth->ring_accum[chan] = accum;
     }
@@ -289,15 +330,77 @@ static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
     return mp_const_none;
 }
 
-static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
-    if (synth_chan == 1) {
-        for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += synthio_sat16((*tmp_buffer32++ *loudness[0]), 16);
+#define LOUDNESS_RAMP_SHIFT (15)
+
+// Filter a voice, adjust its loudness by the envelope and panning, and sum it
+// into the output, all in a single pass over the voice's samples. `filtered`
+// and `stereo` are constants at each call site, so each combination gets its
+// own loop without any per-sample branches.
+//
+// The loudness ramps linearly from `start` to `end` over the block, so that
+// envelope and amplitude changes don't step audibly at each block boundary.
+static inline MP_ALWAYSINLINE void voice_mix(int32_t *out_buffer32, const int32_t *tmp_buffer32, size_t dur, const int16_t start[2], const int16_t end[2], const synthio_biquad_t *filter, biquad_filter_state *st, bool filtered, bool stereo) {
+    // the difference of two int16_t values times 2^15 still fits in int32_t
+    int32_t left = start[0] * (1 << LOUDNESS_RAMP_SHIFT);
+    int32_t right = start[1] * (1 << LOUDNESS_RAMP_SHIFT);
+    int32_t left_step = (end[0] - start[0]) * (1 << LOUDNESS_RAMP_SHIFT) / (int32_t)dur;
+    int32_t right_step = (end[1] - start[1]) * (1 << LOUDNESS_RAMP_SHIFT) / (int32_t)dur;
+
+    // The filter state is kept in locals so the compiler doesn't have to
+    // assume that each store to the output might have changed it
+    int32_t a1 = 0, a2 = 0, b0 = 0, b1 = 0, b2 = 0;
+    int32_t x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+    if (filtered) {
+        a1 = filter->a1;
+        a2 = filter->a2;
+        b0 = filter->b0;
+        b1 = filter->b1;
+        b2 = filter->b2;
+        x0 = st->x[0];
+        x1 = st->x[1];
+        y0 = st->y[0];
+        y1 = st->y[1];
+    }
+
+    for (size_t i = 0; i < dur; i++) {
+        int32_t sample = tmp_buffer32[i];
+        if (filtered) {
+            int32_t output = synthio_sat16((b0 * sample + b1 * x0 + b2 * x1 - a1 * y0 - a2 * y1 + (1 << (BIQUAD_SHIFT - 1))), BIQUAD_SHIFT);
+            x1 = x0;
+            x0 = sample;
+            y1 = y0;
+            y0 = output;
+            sample = output;
+        }
+        left += left_step;
+        *out_buffer32++ += synthio_sat16(sample * (left >> LOUDNESS_RAMP_SHIFT), 16);
+        if (stereo) {
+            right += right_step;
+            *out_buffer32++ += synthio_sat16(sample * (right >> LOUDNESS_RAMP_SHIFT), 16);
+        }
+    }
+
+    if (filtered) {
+        st->x[0] = x0;
+        st->x[1] = x1;
+        st->y[0] = y0;
+        st->y[1] = y1;
+    }
+}
+
+static void sum_with_loudness(int32_t *out_buffer32, const int32_t *tmp_buffer32, const int16_t start[2], const int16_t loudness[2], size_t dur, int synth_chan, mp_obj_t filter_obj, biquad_filter_state *st) {
+    if (filter_obj != mp_const_none) {
+        const synthio_biquad_t *filter = MP_OBJ_TO_PTR(filter_obj);
+        if (synth_chan == 1) {
+            voice_mix(out_buffer32, tmp_buffer32, dur, start, loudness, filter, st, true, false);
+        } else {
+            voice_mix(out_buffer32, tmp_buffer32, dur, start, loudness, filter, st, true, true);
         }
     } else {
-        for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += synthio_sat16((*tmp_buffer32 * loudness[0]), 16);
-            *out_buffer32++ += synthio_sat16((*tmp_buffer32++ *loudness[1]), 16);
+        if (synth_chan == 1) {
+            voice_mix(out_buffer32, tmp_buffer32, dur, start, loudness, NULL, NULL, false, false);
+        } else {
+            voice_mix(out_buffer32, tmp_buffer32, dur, start, loudness, NULL, NULL, false, true);
         }
     }
 }
@@ -332,6 +435,7 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         if (synth->envelope_state[chan].level == 0) {
             // note is truly finished, but we only just noticed
             synth->span.note_obj[chan] = SYNTHIO_SILENCE;
+            synth->loudness_ramp[chan] = false;
             continue;
         }
 
@@ -344,14 +448,22 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         }
 
         mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
+        biquad_filter_state *filter_state = NULL;
         if (filter_obj != mp_const_none) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
             common_hal_synthio_biquad_tick(filter_obj);
-            synthio_biquad_filter_samples(filter_obj, &note->filter_state, tmp_buffer32, dur);
+            filter_state = &note->filter_state;
         }
 
-        // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->base.channel_count);
+        // filter, and adjust loudness by envelope. A new note starts at its
+        // loudness, as its envelope's attack already shapes how it begins.
+        const int16_t *start = synth->loudness_ramp[chan] ? synth->loudness[chan] : loudness;
+        if (dur) {
+            sum_with_loudness(out_buffer32, tmp_buffer32, start, loudness, dur, synth->base.channel_count, filter_obj, filter_state);
+        }
+        synth->loudness[chan][0] = loudness[0];
+        synth->loudness[chan][1] = loudness[1];
+        synth->loudness_ramp[chan] = true;
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -472,6 +584,7 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
             synth->span.note_obj[channel] = new_note;
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
+            synth->loudness_ramp[channel] = false;
         }
         return true;
     }
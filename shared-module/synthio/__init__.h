@@ -18,6 +18,10 @@
 #define SYNTHIO_MIX_DOWN_RANGE_HIGH (28000)
 #define SYNTHIO_MIX_DOWN_SCALE(x) (0xfffffff / (32768 * x - SYNTHIO_MIX_DOWN_RANGE_HIGH))
 
+#if defined(__ARM_FEATURE_SAT)
+#include <arm_acle.h>
+#endif
+
 #include "shared-module/audiocore/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-bindings/synthio/Biquad.h"
@@ -55,6 +59,11 @@ typedef struct synthio_synth {
     uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // the left and right loudness reached at the end of the previous block,
+    // which is where the next block's loudness ramp starts
+    int16_t loudness[CIRCUITPY_SYNTHIO_MAX_CHANNELS][2];
+    // false until a voice's first block is played, which isn't ramped
+    bool loudness_ramp[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
 } synthio_synth_t;
 
 typedef struct {
@@ -96,4 +105,29 @@ extern mp_float_t synthio_global_rate_scale, synthio_global_W_scale;
 extern uint8_t synthio_global_tick;
 void shared_bindings_synthio_lfo_tick(uint32_t sample_rate, uint16_t num_samples);
 
-int16_t synthio_sat16(int32_t n, int rshift);
+// cleaner sat16 by http://www.moseleyinstruments.com/
+//
+// This is inline because the synthesizer and effects call it for every sample.
+static inline int16_t synthio_sat16(int32_t n, int rshift) {
+    // we should always round towards 0
+    // to avoid recirculating round-off noise
+    //
+    // a 2s complement positive number is always
+    // rounded down, so we only need to take
+    // care of negative numbers
+    if (n < 0) {
+        n = n + (~(0xFFFFFFFFUL << rshift));
+    }
+    n = n >> rshift;
+    #if defined(__ARM_FEATURE_SAT)
+    return __ssat(n, 16);
+    #else
+    if (n > 32767) {
+        return 32767;
+    }
+    if (n < -32768) {
+        return -32768;
+    }
+    return n;
+    #endif
+}
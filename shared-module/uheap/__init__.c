@@ -208,6 +208,15 @@ static uint32_t type_size(uint8_t indent_level, mp_obj_type_t *type) {
 static uint32_t instance_size(uint8_t indent_level, mp_obj_instance_t *instance) {
     uint32_t total_size = gc_nbytes(instance);
 
+    #if MICROPY_OPT_INSTANCE_SHAPES
+    const mp_obj_instance_shape_t *shape = mp_obj_instance_get_shape(instance);
+    if (shape != NULL) {
+        for (size_t i = 0; i < shape->n_slots; i++) {
+            total_size += object_size(indent_level + 1, mp_obj_instance_slots(instance, shape)[i]);
+        }
+        return total_size;
+    }
+    #endif
     total_size += map_size(indent_level, &instance->members);
 
     return total_size;
@@ -7,6 +7,7 @@
 #include <string.h>
 
 #include "py/gc.h"
+#include "py/misc.h"
 #include "py/mpconfig.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
@@ -58,8 +59,29 @@ inline bool background_callback_pending(void) {
 
 static int background_prevention_count;
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Budget for one background slice of the sweep, in 1/32768 s subticks.
+#define GC_SWEEP_SLICE_SUBTICKS MAX(1, (uint64_t)CIRCUITPY_GC_SWEEP_SLICE_US * 32768 / 1000000)
+
+// Sweep in small steps until the slice's time budget is spent, so the pause
+// doesn't depend on how slow the heap's memory is (e.g. PSRAM).
+static void background_gc_sweep(void) {
+    uint8_t subticks;
+    uint64_t start = (port_get_raw_ticks(&subticks) << 5) | subticks;
+    while (gc_sweep_step(CIRCUITPY_GC_SWEEP_STEP_BLOCKS)) {
+        uint64_t now = (port_get_raw_ticks(&subticks) << 5) | subticks;
+        if (now - start >= GC_SWEEP_SLICE_SUBTICKS) {
+            break;
+        }
+    }
+}
+#endif
+
 void PLACE_IN_ITCM(background_callback_run_all)(void) {
     port_background_task();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    background_gc_sweep();
+    #endif
     if (!background_callback_pending()) {
         port_yield();
         return;
@@ -664,6 +664,7 @@ void supervisor_bluetooth_file_transfer_background(void) {
                 current_state == DELETE ||
                 current_state == MKDIR ||
                 current_state == MOVE) {
+                mp_vfs_import_cache_invalidate();
                 autoreload_trigger();
             }
         }
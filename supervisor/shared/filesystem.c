@@ -298,6 +298,9 @@ fs_user_mount_t *filesystem_for_path(const char *path_in, const char **path_unde
     *path_under_mount = path_in;
     if (vfs == MP_VFS_ROOT) {
         fs_mount = filesystem_circuitpy();
+    } else if (!mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+        // Other filesystems, such as a VfsRom, have no fs_user_mount_t.
+        return NULL;
     } else {
         fs_mount = MP_OBJ_TO_PTR(vfs->obj);
         // Check if the vfs name is one character long: it must be "/" in that case.
@@ -137,7 +137,7 @@ static fs_user_mount_t *get_vfs(int lun) {
     if (lun == SAVES_LUN) {
         const char *path_under_mount;
         fs_user_mount_t *saves = filesystem_for_path("/saves", &path_under_mount);
-        if (saves != root &&
+        if (saves != NULL && saves != root &&
             (saves->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) != 0 && !gc_ptr_on_heap(saves)) {
             return saves;
         }
@@ -153,7 +153,7 @@ static fs_user_mount_t *get_vfs(int lun) {
         // not on the heap.
         // If the SD card filesystem was mounted by the user using heap objects,
         // it should not be used when the VM has stopped running.
-        if ((sdcard != root) &&
+        if (sdcard != NULL && (sdcard != root) &&
             ((sdcard->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) != 0) &&
             (vm_is_running() || !gc_ptr_on_heap(sdcard))) {
             return sdcard;
@@ -329,6 +329,7 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     // All other writes will trigger auto-reload.
     if (lba >= vfs->fatfs.fatbase) {
         content_write[lun] = true;
+        mp_vfs_import_cache_invalidate();
     }
 
     return block_count * MSC_FLASH_BLOCK_SIZE;
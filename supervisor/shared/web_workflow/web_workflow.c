@@ -1553,6 +1553,7 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
     common_hal_socketpool_socket_close(socket);
     autoreload_resume(AUTORELOAD_SUSPEND_WEB);
     if (reload) {
+        mp_vfs_import_cache_invalidate();
         autoreload_trigger();
     }
 }
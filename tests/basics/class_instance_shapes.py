@@ -0,0 +1,107 @@
+# Test that instance attributes stay correct when instances of a class assign
+# them in different orders, delete them, or have more than fit in slots.
+
+
+class A:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+
+def get(o):
+    return o.x, o.y
+
+
+# Instances that share a layout, and one that assigns in another order.
+a1 = A(1, 2)
+a2 = A(3, 4)
+a3 = A(5, 6)
+del a3.x
+a3.z = 7
+a3.x = 8
+for o in (a1, a2, a3, a1):
+    print(get(o))
+print(a3.z)
+
+# Overwriting an attribute keeps the others.
+a1.x = "x"
+print(get(a1), get(a2))
+
+# Deleting falls back to a map, and the attribute is gone.
+del a2.y
+try:
+    a2.y
+except AttributeError:
+    print("AttributeError")
+try:
+    del a2.y
+except AttributeError:
+    print("AttributeError")
+a2.y = 9
+print(get(a2))
+
+# Attributes shadow methods of the class.
+class B:
+    def f(self):
+        return "B.f"
+
+
+b = B()
+print(b.f())
+b.f = lambda: "instance f"
+print(b.f())
+del b.f
+print(b.f())
+
+# Many attributes, added after __init__, still all load back.
+class C:
+    pass
+
+
+for n in (1, 5, 40):
+    objs = [C() for _ in range(3)]
+    for i, c in enumerate(objs):
+        for j in range(n):
+            setattr(c, "a%d" % j, i * 100 + j)
+    print([sum(getattr(c, "a%d" % j) for j in range(n)) for c in objs])
+    print([hasattr(c, "a%d" % n) for c in objs])
+
+# Subclass of a native type keeps its native object apart from the attributes.
+class L(list):
+    def __init__(self):
+        super().__init__([1, 2])
+        self.p = 3
+        self.q = 4
+
+
+for _ in range(3):
+    l = L()
+    l.append(l.p + l.q)
+    print(l, l.p, l.q)
+
+# setattr and delattr go through the same slots as attribute syntax.
+a4 = A(10, 20)
+setattr(a4, "x", 11)
+setattr(a4, "w", 30)
+print(get(a4), getattr(a4, "w"))
+delattr(a4, "w")
+print(hasattr(a4, "w"), get(a4))
+try:
+    delattr(a4, "w")
+except AttributeError:
+    print("AttributeError")
+
+# A class whose instances have more attributes than fit in slots: the first
+# ones overflow while being made, the later ones start out with a map.
+class Big:
+    def __init__(self, n):
+        for j in range(n):
+            setattr(self, "b%d" % j, j)
+
+
+for n in (15, 16, 17, 30, 3):
+    objs = [Big(n) for _ in range(3)]
+    print(n, [sum(getattr(o, "b%d" % j) for j in range(n)) for o in objs])
+    objs[1].b0 = -1
+    del objs[2].b1
+    print(objs[0].b0, objs[1].b0, hasattr(objs[2], "b1"))
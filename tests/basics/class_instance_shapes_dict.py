@@ -0,0 +1,47 @@
+# Test __dict__, object.__setattr__ and object.__delattr__ on instances whose
+# attributes are kept in slots, and after they move to a map.
+
+
+class A:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+
+a = A(1, 2)
+if not hasattr(a, "__dict__"):
+    print("SKIP")
+    raise SystemExit
+
+print(sorted(a.__dict__.items()))
+b = A(3, 4)
+b.z = 5
+print(sorted(b.__dict__.items()))
+
+a.x = 10
+print(sorted(a.__dict__.items()))
+
+# object.__setattr__ and object.__delattr__ act on the instance.
+object.__setattr__(a, "w", 6)
+print(sorted(a.__dict__.items()))
+object.__delattr__(a, "x")
+print(sorted(a.__dict__.items()), hasattr(a, "x"))
+try:
+    object.__delattr__(a, "x")
+except AttributeError:
+    print("AttributeError")
+
+# Deleting moves b to a map; its __dict__ is still right.
+del b.y
+print(sorted(b.__dict__.items()))
+
+# A class with more attributes than fit in slots.
+class Big:
+    def __init__(self):
+        for j in range(20):
+            setattr(self, "b%d" % j, j)
+
+
+for _ in range(2):
+    o = Big()
+    print(len(o.__dict__), sum(o.__dict__.values()))
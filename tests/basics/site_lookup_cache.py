@@ -0,0 +1,113 @@
+# Test that attribute, method and global lookups stay correct when the maps
+# they are found in change between executions of the same bytecode.
+
+
+class A:
+    def __init__(self):
+        self.x = 1
+
+    def f(self):
+        return "A.f"
+
+
+class B:
+    def __init__(self):
+        self.y = 0
+        self.x = 2
+
+    def f(self):
+        return "B.f"
+
+
+class C(A):
+    pass
+
+
+def get_x(o):
+    return o.x
+
+
+def call_f(o):
+    return o.f()
+
+
+# Same site, different types and member layouts.
+for o in (A(), B(), A(), C(), B()):
+    print(get_x(o), call_f(o))
+
+# Members added, removed and rehashed between executions.
+a = A()
+print(get_x(a))
+for i in range(20):
+    setattr(a, "m%d" % i, i)
+a.x = 3
+print(get_x(a))
+del a.x
+try:
+    get_x(a)
+except AttributeError:
+    print("AttributeError")
+a.x = 4
+print(get_x(a))
+
+# Instance member shadowing a method.
+a = A()
+print(call_f(a))
+a.f = lambda: "member"
+print(call_f(a))
+del a.f
+print(call_f(a))
+
+
+# Method replaced and removed on the class.
+def new_f(self):
+    return "new A.f"
+
+
+a = A()
+print(call_f(a))
+A.f = new_f
+print(call_f(a), call_f(C()))
+del A.f
+try:
+    call_f(a)
+except AttributeError:
+    print("AttributeError")
+A.f = new_f
+
+# Method inherited from a base class, then overridden in the subclass.
+c = C()
+print(call_f(c))
+C.f = lambda self: "C.f"
+print(call_f(c))
+
+
+def get_g():
+    return g
+
+
+# Global defined, redefined, deleted and shadowing a builtin.
+try:
+    get_g()
+except NameError:
+    print("NameError")
+g = 1
+print(get_g())
+g = 2
+print(get_g())
+del g
+try:
+    get_g()
+except NameError:
+    print("NameError")
+
+
+def get_len():
+    return len
+
+
+print(get_len() is len)
+len = 5
+print(get_len())
+del len
+print(get_len()("abc"))
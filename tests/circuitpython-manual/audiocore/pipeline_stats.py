@@ -0,0 +1,51 @@
+# Time an audio graph without an audio output, and report how much faster than
+# real time each part of it runs. Needs a build with audiocore.stats and
+# audiocore.get_buffer, such as the unix coverage build:
+#
+#   micropython pipeline_stats.py [seconds]
+
+import array
+import audiocore
+import audiodelays
+import audiomixer
+import math
+import sys
+
+SAMPLE_RATE = 22050
+seconds = float(sys.argv[1]) if len(sys.argv) > 1 else 5
+
+tone = array.array(
+    "h", [int(8000 * math.sin(2 * math.pi * i / 50)) for i in range(SAMPLE_RATE // 10)]
+)
+voices = [audiocore.RawSample(tone, sample_rate=SAMPLE_RATE) for _ in range(4)]
+mixer = audiomixer.Mixer(
+    voice_count=len(voices), sample_rate=SAMPLE_RATE, channel_count=1, buffer_size=1024
+)
+echo = audiodelays.Echo(
+    max_delay_ms=200, delay_ms=150, decay=0.5, sample_rate=SAMPLE_RATE, buffer_size=1024
+)
+resampler = audiocore.Resampler(echo, sample_rate=48000)
+nodes = ((resampler, "resampler"), (echo, "echo"), (mixer, "mixer"), (voices[0], "voice 0"))
+
+for i, voice in enumerate(voices):
+    mixer.voice[i].play(voice, loop=True)
+echo.play(mixer)
+
+# Pull from the end of the graph, as an audio output would
+frames = 0
+audiocore.reset_buffer(resampler)
+while frames < seconds * resampler.sample_rate:
+    result, data = audiocore.get_buffer(resampler)
+    frames += len(data)
+    if result != 1:
+        break
+
+print("node         calls   frames  time_us  max_us  late stalls   x real time")
+for node, name in nodes:
+    s = audiocore.stats(node)
+    speed = s.frames / node.sample_rate / (s.time_us / 1e6) if s.time_us else 0
+    print(
+        "{:10} {:7d} {:8d} {:8d} {:7d} {:5d} {:6d} {:13.1f}".format(
+            name, s.calls, s.frames, s.time_us, s.max_time_us, s.late, s.stalls, speed
+        )
+    )
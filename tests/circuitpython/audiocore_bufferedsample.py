@@ -0,0 +1,45 @@
+import array
+import audiocore
+import synthio
+
+
+def drain(sample):
+    audiocore.reset_buffer(sample)
+    while True:
+        result, buf = audiocore.get_buffer(sample)
+        print(result, list(buf))
+        if result != 1:
+            break
+
+
+raw = audiocore.RawSample(array.array("h", range(-5, 6)), sample_rate=8000)
+b = audiocore.BufferedSample(raw, lead_time=0)
+print(audiocore.get_structure(b), b.sample_rate, b.channel_count, b.bits_per_sample)
+drain(b)
+# looping starts over from the beginning
+drain(b)
+
+raw8 = audiocore.RawSample(array.array("B", [1, 2, 3, 4, 5, 6, 7]), sample_rate=8000)
+drain(audiocore.BufferedSample(raw8))
+
+# a sample that never ends
+s = synthio.Synthesizer(sample_rate=8000)
+s.press(64)
+b = audiocore.BufferedSample(s, lead_time=0.25)
+print(audiocore.get_structure(b), b.lead_time)
+audiocore.reset_buffer(b)
+for _ in range(3):
+    result, buf = audiocore.get_buffer(b)
+    print(result, len(buf), list(buf[:8]))
+print(b.underruns)
+
+try:
+    audiocore.BufferedSample(raw, lead_time=11)
+except ValueError as e:
+    print(e)
+
+b.deinit()
+try:
+    b.underruns
+except ValueError as e:
+    print(e)
@@ -0,0 +1,44 @@
+import array
+import audiocore
+import audiomixer
+import io
+
+ramp = array.array("h", range(0, 1000, 10))
+raw = audiocore.RawSample(ramp, sample_rate=8000)
+
+# a buffer is filled by default, here with all of a sample that ends early
+out = array.array("h", [-1] * 120)
+print(audiocore.render(raw, out), out[:4], out[98:])
+
+# fewer frames can be asked for, and rendering starts from the beginning each time
+out = array.array("h", [-1] * 8)
+print(audiocore.render(raw, out, 5), list(out))
+print(audiocore.render(raw, out, frames=8), list(out))
+
+# a mixer never ends, so plays its looping voice for as long as asked. Resetting
+# it would stop its voices.
+mixer = audiomixer.Mixer(voice_count=1, sample_rate=8000, channel_count=1, buffer_size=64)
+mixer.voice[0].play(raw, loop=True)
+out = array.array("h", [0] * 250)
+print(audiocore.render(mixer, out, reset=False), out[98:102], out[198:202])
+
+# or to a stream, as bytes. Without a reset, rendering continues where it
+# stopped, after the 32 frames of the mixer's last buffer.
+stream = io.BytesIO()
+print(audiocore.render(mixer, stream, 3, reset=False), stream.getvalue())
+print(audiocore.render(mixer, stream, 2, reset=False), stream.getvalue())
+stream = io.BytesIO()
+print(audiocore.render(raw, stream), len(stream.getvalue()))
+
+# frames must fit in the buffer
+try:
+    audiocore.render(raw, array.array("h", [0] * 4), 5)
+except ValueError as e:
+    print("ValueError")
+
+# the output must be a buffer or a binary stream
+for output in (None, io.StringIO()):
+    try:
+        audiocore.render(raw, output)
+    except (TypeError, OSError) as e:
+        print(type(e).__name__)
@@ -0,0 +1,91 @@
+import array
+import audiocore
+import audiomixer
+import math
+
+
+def drain(sample):
+    audiocore.reset_buffer(sample)
+    frames = []
+    while True:
+        result, buf = audiocore.get_buffer(sample)
+        frames.extend(buf)
+        if result != 1:
+            return result, frames
+
+
+sine = array.array("h", [int(10000 * math.sin(2 * math.pi * i / 16)) for i in range(64)])
+raw = audiocore.RawSample(sine, sample_rate=8000)
+
+# upsampling, at each quality
+for quality in (
+    audiocore.ResamplerQuality.LOW,
+    audiocore.ResamplerQuality.MEDIUM,
+    audiocore.ResamplerQuality.HIGH,
+):
+    r = audiocore.Resampler(raw, sample_rate=16000, quality=quality, buffer_size=64)
+    print(r.quality, r.sample_rate, r.channel_count, r.bits_per_sample)
+    result, frames = drain(r)
+    print(result, len(frames), frames[30:38])
+    # it can be played again
+    print(drain(r)[1] == frames)
+
+# the same rate passes the sample through unchanged, even at full scale, and
+# doubling the rate keeps every input frame
+full = array.array("h", [32767, -32768, 32767, 16385, -16385, 1, 0, -1] * 4)
+full_raw = audiocore.RawSample(full, sample_rate=8000)
+for quality in (
+    audiocore.ResamplerQuality.LOW,
+    audiocore.ResamplerQuality.MEDIUM,
+    audiocore.ResamplerQuality.HIGH,
+):
+    print(drain(audiocore.Resampler(raw, sample_rate=8000, quality=quality))[1] == list(sine))
+    print(drain(audiocore.Resampler(full_raw, sample_rate=8000, quality=quality))[1] == list(full))
+    print(drain(audiocore.Resampler(full_raw, sample_rate=16000, quality=quality))[1][::2] == list(full))
+
+# downsampling by a non-integer ratio
+r = audiocore.Resampler(raw, sample_rate=3000, buffer_size=16)
+result, frames = drain(r)
+print(result, len(frames), frames[:8])
+
+# stereo, and unsigned 8 bit samples
+stereo = array.array("h", [v for i in range(32) for v in (1000 * i, -1000 * i)])
+r = audiocore.Resampler(
+    audiocore.RawSample(stereo, channel_count=2, sample_rate=11025),
+    sample_rate=22050,
+    quality=audiocore.ResamplerQuality.LOW,
+)
+result, frames = drain(r)
+print(r.channel_count, len(frames), frames[:8])
+r = audiocore.Resampler(
+    audiocore.RawSample(array.array("B", range(100, 164, 4)), sample_rate=4000),
+    sample_rate=8000,
+    quality=audiocore.ResamplerQuality.LOW,
+)
+print(r.bits_per_sample, drain(r)[1][:9])
+
+# a mixer plays samples with other rates through a resampler
+mixer = audiomixer.Mixer(voice_count=1, sample_rate=16000, buffer_size=128)
+try:
+    mixer.voice[0].play(raw)
+except ValueError as e:
+    print(e)
+mixer.voice[0].play(audiocore.Resampler(raw, sample_rate=16000, buffer_size=40), loop=True)
+for _ in range(4):
+    result, buf = audiocore.get_buffer(mixer)
+    print(result, list(buf[:4]))
+
+try:
+    audiocore.Resampler(raw, sample_rate=0)
+except ValueError as e:
+    print(e)
+try:
+    audiocore.Resampler(raw, sample_rate=8000, quality=2)
+except TypeError as e:
+    print(e)
+
+r.deinit()
+try:
+    r.quality
+except ValueError as e:
+    print(e)
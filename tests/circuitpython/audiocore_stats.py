@@ -0,0 +1,30 @@
+import array
+import audiocore
+import audiomixer
+
+tone = array.array("h", [1000, -1000] * 128)
+raw = audiocore.RawSample(tone, sample_rate=8000)
+mixer = audiomixer.Mixer(voice_count=1, sample_rate=8000, buffer_size=128)
+
+# nothing has been asked for yet
+s = audiocore.stats(mixer)
+print(type(s).__name__, s.calls, s.frames, s.time_us, s.max_time_us, s.late, s.stalls, s.errors, s.underruns)
+
+mixer.voice[0].play(raw)
+audiocore.reset_buffer(mixer)
+for i in range(8):
+    audiocore.get_buffer(mixer)
+
+# the mixer and the sample it plays each keep their own stats
+for sample in (mixer, raw):
+    s = audiocore.stats(sample)
+    print(s.calls, s.frames, s.stalls, s.errors, s.max_time_us <= s.time_us)
+
+# the stats can be read and cleared at once
+print(audiocore.stats(mixer, reset=True).calls)
+print(audiocore.stats(mixer))
+
+try:
+    audiocore.stats(1)
+except TypeError as e:
+    print("TypeError")
@@ -0,0 +1,99 @@
+import array
+import audiocore
+import os
+import struct
+
+try:
+    os.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = []
+
+    def readblocks(self, n, buf):
+        self.reads.append(len(buf) // self.SEC_SIZE)
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMFS(100)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+
+def write_wave(name, data, channel_count, bits_per_sample):
+    block_align = channel_count * bits_per_sample // 8
+    with open(name, "wb") as f:
+        f.write(b"RIFF")
+        f.write(struct.pack("<I", 36 + len(data)))
+        f.write(b"WAVEfmt ")
+        f.write(
+            struct.pack(
+                "<IHHIIHH", 16, 1, channel_count, 8000, 8000 * block_align, block_align, bits_per_sample
+            )
+        )
+        f.write(b"data")
+        f.write(struct.pack("<I", len(data)))
+        f.write(data)
+
+
+def play(wave):
+    audiocore.reset_buffer(wave)
+    buffers = []
+    while True:
+        result, buf = audiocore.get_buffer(wave)
+        buffers.append(bytes(buf))
+        if result != 1:
+            return result, buffers
+
+
+stereo = bytes(array.array("h", range(-3000, 3000)))
+write_wave("/ramdisk/stereo.wav", stereo, 2, 16)
+
+# Streaming plays the same data as the double buffers, in bigger pieces
+result, small = play(audiocore.WaveFile("/ramdisk/stereo.wav"))
+print(result, len(small), b"".join(small) == stereo)
+wave = audiocore.WaveFile("/ramdisk/stereo.wav", chunk_size=1000)
+print(audiocore.get_structure(wave))
+bdev.reads = []
+result, chunks = play(wave)
+print(result, [len(c) for c in chunks], b"".join(chunks) == stereo)
+# Each sector is read once
+print(sum(bdev.reads))
+# Looping starts over from the beginning
+print(play(wave)[1] == chunks)
+# So does a reset part way through, which drops the chunk read ahead
+audiocore.reset_buffer(wave)
+audiocore.get_buffer(wave)
+audiocore.get_buffer(wave)
+print(play(wave)[1] == chunks)
+
+# The end is padded to a whole word
+mono8 = bytes(range(1, 199, 2))
+write_wave("/ramdisk/mono8.wav", mono8, 1, 8)
+result, chunks = play(audiocore.WaveFile("/ramdisk/mono8.wav", chunk_size=512))
+print(result, [len(c) for c in chunks], list(chunks[-1][-6:]))
+
+try:
+    audiocore.WaveFile("/ramdisk/mono8.wav", chunk_size=40000)
+except ValueError as e:
+    print(e)
+
+os.umount("/ramdisk")
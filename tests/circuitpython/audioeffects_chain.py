@@ -0,0 +1,85 @@
+import array
+import audiocore
+import audiodelays
+import audioeffects
+import audiofilters
+import audiofreeverb
+import synthio
+
+src = array.array("h", [(i * 2477) % 40000 - 20000 for i in range(1000)])
+
+
+def collect(sample, nbuf):
+    audiocore.reset_buffer(sample)
+    out = []
+    for _ in range(nbuf):
+        result, buf = audiocore.get_buffer(sample)
+        out.extend(buf)
+    return out
+
+
+def effects(channel_count):
+    settings = dict(sample_rate=8000, channel_count=channel_count)
+    return (
+        audiofilters.Distortion(drive=0.5, mix=0.8, **settings),
+        audiodelays.Echo(max_delay_ms=50, delay_ms=20, decay=0.5, **settings),
+        audiodelays.Chorus(voices=3, **settings),
+        audiodelays.PitchShift(semitones=3, **settings),
+        audiodelays.MultiTapDelay(max_delay_ms=50, delay_ms=10, taps=(0.3, (0.8, 0.5)), **settings),
+        audiofilters.Filter(filter=synthio.Biquad(synthio.FilterMode.LOW_PASS, 1000), **settings),
+        audiofilters.Phaser(**settings),
+        audiofreeverb.Freeverb(**settings),
+    )
+
+
+# A chain sounds the same as playing the effects into one another
+for channel_count in (1, 2):
+    raw = audiocore.RawSample(src, sample_rate=8000, channel_count=channel_count)
+    nested = raw
+    for effect in effects(channel_count):
+        nested = effect.play(nested, loop=True)
+    chain = audioeffects.Chain(effects(channel_count))
+    print(audiocore.get_structure(chain), len(chain.effects), chain.playing)
+    chain.play(raw, loop=True)
+    print(chain.playing, collect(nested, 8) == collect(chain, 8))
+
+# After the sample ends, the echo dies away
+raw = audiocore.RawSample(src[:100], sample_rate=8000)
+echo = audiodelays.Echo(max_delay_ms=20, delay_ms=10, decay=0.5, mix=1, sample_rate=8000)
+chain = audioeffects.Chain([echo], buffer_size=64)
+chain.play(raw)
+audiocore.reset_buffer(chain)
+for _ in range(6):
+    result, buf = audiocore.get_buffer(chain)
+    print(result, max(buf), min(buf))
+print(chain.playing)
+
+# 8 bit unsigned samples are processed as 16 bit samples
+raw8 = audiocore.RawSample(array.array("B", [128, 192, 255, 64, 0, 128, 160, 96]), sample_rate=8000)
+distortion = audiofilters.Distortion(
+    drive=0.5, bits_per_sample=8, samples_signed=False, sample_rate=8000
+)
+chain = audioeffects.Chain([distortion], buffer_size=8)
+chain.play(raw8, loop=True)
+print(list(collect(chain, 1)))
+
+try:
+    audioeffects.Chain([raw])
+except TypeError as e:
+    print(e)
+
+try:
+    audioeffects.Chain([echo, audiofilters.Phaser(sample_rate=16000)])
+except ValueError as e:
+    print(e)
+
+try:
+    audioeffects.Chain([])
+except ValueError as e:
+    print(e)
+
+chain.deinit()
+try:
+    chain.effects
+except ValueError as e:
+    print(e)
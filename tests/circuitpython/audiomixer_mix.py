@@ -0,0 +1,76 @@
+import array
+import audiocore
+import audiomixer
+
+
+def mix(voices, *, channel_count=1, bits_per_sample=16, samples_signed=True, buffer_size=64):
+    mixer = audiomixer.Mixer(
+        voice_count=len(voices),
+        buffer_size=buffer_size,
+        channel_count=channel_count,
+        sample_rate=8000,
+        bits_per_sample=bits_per_sample,
+        samples_signed=samples_signed,
+    )
+    for i, (sample, level, panning) in enumerate(voices):
+        mixer.voice[i].level = level
+        mixer.voice[i].panning = panning
+        mixer.voice[i].play(sample, loop=True)
+    return list(audiocore.get_buffer(mixer)[1])
+
+
+def sample(typecode, data, channel_count=1):
+    return audiocore.RawSample(array.array(typecode, data), channel_count=channel_count, sample_rate=8000)
+
+
+ramp16 = [(i * 4099) % 65536 - 32768 for i in range(16)]
+ramp8 = [(i * 37) % 256 - 128 for i in range(16)]
+
+# One voice, scaled
+print(mix([(sample("h", ramp16), 1.0, 0)]))
+print(mix([(sample("h", ramp16), 0.5, 0)]))
+# Two voices, added with saturation
+print(mix([(sample("h", ramp16), 1.0, 0), (sample("h", ramp16[::-1]), 0.75, 0)]))
+print(mix([(sample("h", [30000] * 16), 1.0, 0), (sample("h", [-20000, 20000] * 8), 1.0, 0)]))
+# Stereo, with panning
+print(mix([(sample("h", ramp16, 2), 0.5, -0.5)], channel_count=2))
+print(mix([(sample("h", ramp16, 2), 1.0, 0), (sample("h", ramp16[::-1], 2), 0.5, 1)], channel_count=2))
+# Mono samples played by a stereo mixer
+print(mix([(sample("h", ramp16), 0.5, 0.25)], channel_count=2))
+print(mix([(sample("h", ramp16), 1.0, 0), (sample("h", ramp16[::-1]), 1.0, -1)], channel_count=2))
+# Unsigned 16 bit
+print(mix([(sample("H", [v + 32768 for v in ramp16]), 0.5, 0)], samples_signed=False))
+print(
+    mix(
+        [
+            (sample("H", [v + 32768 for v in ramp16]), 0.5, 0),
+            (sample("H", [v + 32768 for v in ramp16[::-1]]), 0.5, 0),
+        ],
+        samples_signed=False,
+    )
+)
+# 8 bit, signed and unsigned, mono and stereo
+print(mix([(sample("b", ramp8), 0.5, 0)], bits_per_sample=8, buffer_size=32))
+print(
+    mix(
+        [(sample("b", ramp8), 1.0, 0), (sample("b", ramp8[::-1]), 1.0, 0)],
+        bits_per_sample=8,
+        buffer_size=32,
+    )
+)
+print(
+    mix(
+        [(sample("B", [v + 128 for v in ramp8]), 0.5, 0)],
+        bits_per_sample=8,
+        samples_signed=False,
+        buffer_size=32,
+    )
+)
+print(
+    mix(
+        [(sample("b", ramp8), 1.0, 0.5), (sample("b", ramp8[::-1], 2), 0.5, 0)],
+        channel_count=2,
+        bits_per_sample=8,
+        buffer_size=32,
+    )
+)
@@ -0,0 +1,120 @@
+# Test that imports of .py files cache their compiled code in /.mpycache
+
+import os
+import sys
+
+try:
+    os.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def make_fs():
+    bdev = RAMFS(50)
+    os.VfsFat.mkfs(bdev)
+    return os.VfsFat(bdev)
+
+
+os.mount(make_fs(), "/ramdisk")
+sys.path.insert(0, "/ramdisk")
+
+
+def write_mod(value):
+    with open("/ramdisk/mod.py", "w") as f:
+        f.write("value = %r\ndef f(x):\n    return value + x\n" % value)
+
+
+def import_mod():
+    sys.modules.pop("mod", None)
+    mod = __import__("mod")
+    print(mod.__file__, mod.f("!"))
+
+
+def cache_files():
+    return [name for name in os.listdir("/.mpycache") if name.endswith(".mpy")]
+
+
+def patch_cache(old, new):
+    (name,) = cache_files()
+    with open("/.mpycache/" + name, "rb") as f:
+        data = f.read()
+    with open("/.mpycache/" + name, "wb") as f:
+        f.write(data.replace(old, new))
+    return data
+
+
+# without the cache directory nothing is cached
+write_mod("source")
+import_mod()
+
+# the first import compiles and caches the module, the second loads the cached code
+cache = make_fs()
+os.mount(cache, "/.mpycache")
+import_mod()
+print(len(cache_files()))
+patch_cache(b"source", b"cached")
+import_mod()
+
+# a change to the source is compiled and cached again
+write_mod("edited!")
+import_mod()
+print(len(cache_files()))
+import_mod()
+# even one that keeps the size and modification time
+write_mod("edited?")
+import_mod()
+write_mod("edited!")
+import_mod()
+
+# a cache file that isn't valid .mpy data is ignored, and replaced
+data = patch_cache(b"", b"")
+# the .mpy data follows the path, a null and 13 bytes of size, mtime, hash and optimisation level
+mpy_start = data.index(b"\x00") + 14
+print(data[mpy_start : mpy_start + 1])
+with open("/.mpycache/" + cache_files()[0], "wb") as f:
+    f.write(data[:mpy_start] + b"X" + data[mpy_start + 1 :])
+import_mod()
+patch_cache(b"edited!", b"cached!")
+import_mod()
+print([name[-4:] for name in os.listdir("/.mpycache")])
+
+# a syntax error isn't cached
+with open("/ramdisk/mod.py", "w") as f:
+    f.write("value = (\n")
+try:
+    import_mod()
+except SyntaxError:
+    print("SyntaxError")
+
+# a read-only cache is used but not written
+write_mod("read-only")
+os.umount("/.mpycache")
+os.mount(cache, "/.mpycache", readonly=True)
+import_mod()
+import_mod()
+
+os.umount("/.mpycache")
+os.umount("/ramdisk")
+sys.path.pop(0)
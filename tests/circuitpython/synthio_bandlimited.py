@@ -0,0 +1,33 @@
+import array
+import synthio
+import audiocore
+
+saw = array.array("h", [i * 250 - 32000 for i in range(256)])
+bl = synthio.BandlimitedWaveform(saw)
+print(bl.levels)
+print(bytes(memoryview(bl)) == bytes(saw))
+try:
+    memoryview(bl)[0] = 0
+except TypeError:
+    print("read-only")
+
+print(synthio.BandlimitedWaveform(array.array("h", [0] * 12)).levels)
+print(synthio.BandlimitedWaveform(array.array("h", [0] * 2)).levels)
+
+
+def dump_samples(s):
+    print([i for i in audiocore.get_buffer(s)[1][:24]])
+
+
+for frequency in (110, 3520, 7040):
+    s = synthio.Synthesizer(sample_rate=48000)
+    s.press(synthio.Note(frequency, waveform=bl))
+    dump_samples(s)
+
+s = synthio.Synthesizer(sample_rate=48000, waveform=bl)
+s.press(synthio.Note(7040))
+dump_samples(s)
+
+s = synthio.Synthesizer(sample_rate=48000)
+s.press(synthio.Note(220, waveform=bl, ring_frequency=5000, ring_waveform=bl))
+dump_samples(s)
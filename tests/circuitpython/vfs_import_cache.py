@@ -0,0 +1,95 @@
+# Test that imports see changes to the directories they have already indexed
+
+import os
+import sys
+
+try:
+    os.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMFS(100)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+os.mkdir("/ramdisk/lib")
+for i in range(40):
+    with open("/ramdisk/lib/filler%d.txt" % i, "w") as f:
+        f.write("x")
+sys.path.insert(0, "/ramdisk/lib")
+
+
+def try_import(name):
+    sys.modules.pop(name, None)
+    try:
+        print(name, __import__(name).value)
+    except ImportError:
+        print(name, "not found")
+
+
+def write(path, value):
+    with open(path, "w") as f:
+        f.write("value = %r\n" % value)
+
+
+# once the directory is indexed, missing modules are found missing without reading it
+try_import("mod_a")
+bdev.reads = 0
+try_import("mod_a")
+try_import("mod_b")
+print("reads", bdev.reads)
+
+# files that are written, renamed or removed are seen
+write("/ramdisk/lib/mod_a.py", "a")
+try_import("mod_a")
+write("/ramdisk/mod_b.py", "b")
+try_import("mod_b")
+os.rename("/ramdisk/mod_b.py", "/ramdisk/lib/mod_b.py")
+try_import("mod_b")
+os.remove("/ramdisk/lib/mod_a.py")
+try_import("mod_a")
+
+# as are new packages
+os.mkdir("/ramdisk/lib/pkg")
+write("/ramdisk/lib/pkg/__init__.py", "pkg")
+try_import("pkg")
+
+# FAT ignores case, and so does the index
+write("/ramdisk/lib/Mixed.py", "mixed")
+try_import("mixed")
+
+# the current directory is indexed separately
+os.chdir("/ramdisk/lib")
+sys.path.insert(0, "")
+try_import("mod_b")
+os.chdir("/")
+try_import("mod_b")
+
+sys.path.pop(0)
+sys.path.pop(0)
+os.umount("/ramdisk")
+try_import("mod_b")
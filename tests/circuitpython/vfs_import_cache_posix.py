@@ -0,0 +1,36 @@
+# Test that imports from a VfsPosix directory see files made by other processes
+
+import os
+import sys
+
+try:
+    os.system
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+# We need a directory for testing that doesn't already exist.
+# Skip the test if it does exist.
+temp_dir = "micropy_import_cache_dir"
+try:
+    os.stat(temp_dir)
+    print("SKIP")
+    raise SystemExit
+except OSError:
+    pass
+
+os.mkdir(temp_dir)
+sys.path.insert(0, temp_dir)
+
+try:
+    import import_cache_mod
+except ImportError:
+    print("ImportError")
+
+# another process adds the module, which the VM doesn't see written
+os.system("echo 'print(\"imported\")' > %s/import_cache_mod.py" % temp_dir)
+import import_cache_mod
+
+sys.path.pop(0)
+os.remove(temp_dir + "/import_cache_mod.py")
+os.rmdir(temp_dir)
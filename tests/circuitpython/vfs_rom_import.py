@@ -0,0 +1,129 @@
+# Test that modules imported from a VfsRom run in place, without copying the image into RAM
+
+import gc
+import os
+import sys
+
+try:
+    os.VfsRom
+    os.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def encode_uint(value):
+    encoded = [value & 0x7F]
+    value >>= 7
+    while value != 0:
+        encoded.insert(0, 0x80 | (value & 0x7F))
+        value >>= 7
+    return bytes(encoded)
+
+
+def record(kind, payload):
+    return encode_uint(kind) + encode_uint(len(payload)) + payload
+
+
+def romfs_file(name, data):
+    return record(5, encode_uint(len(name)) + name + record(2, data))
+
+
+def romfs_dir(name, records):
+    return record(4, encode_uint(len(name)) + name + b"".join(records))
+
+
+def romfs(records):
+    data = b"".join(records)
+    header = b"\xd2\xcd\x31" + encode_uint(len(data))
+    if (len(header) + len(data)) % 2:
+        header = b"\xd2\xcd\x31\x80" + encode_uint(len(data))
+    return header + data
+
+
+# The .mpy of a module that is:
+#   s = "xx...x"  # `n` characters
+#   def f():
+#       x = 1; x = 1
+#       return x
+def make_mpy(n):
+    return (
+        b"C\x06\x00\x1f\x04\x01"
+        + b"\x0cmod.py\x00\x0f\x02f\x00\x02s\x00"
+        + b"\x05"
+        + encode_uint(n)
+        + b"x" * n
+        + b"\x00"
+        + b"\x74\x00\x04\x01\x24\x23\x00\x16\x03\x32\x00\x16\x02\x51\x63"
+        + b"\x01\x58\x08\x06\x02\x40\x24\x81\xc0\x81\xc0\xb0\x63"
+    )
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+mpy = make_mpy(4000)
+image = romfs(
+    (
+        romfs_file(b"readme.txt", b"hello"),
+        romfs_dir(b"lib", (romfs_file(b"mod.mpy", mpy), romfs_file(b"pymod.py", b"y = 2\n"))),
+    )
+)
+os.mount(os.VfsRom(image), "/rom")
+print(sorted(os.listdir("/rom")), sorted(os.listdir("/rom/lib")))
+with open("/rom/readme.txt") as f:
+    print(f.read())
+try:
+    open("/rom/readme.txt", "w")
+except OSError:
+    print("read-only")
+
+bdev = RAMFS(50)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+with open("/ramdisk/mod.mpy", "wb") as f:
+    f.write(mpy)
+
+
+def import_from(path):
+    sys.path.insert(0, path)
+    sys.modules.pop("mod", None)
+    gc.collect()
+    before = gc.mem_alloc()
+    mod = __import__("mod")
+    gc.collect()
+    used = gc.mem_alloc() - before
+    sys.path.pop(0)
+    print(mod.__file__, len(mod.s), mod.f())
+    return mod, used
+
+
+mod_rom, rom_used = import_from("/rom/lib")
+mod_ram, ram_used = import_from("/ramdisk")
+# Only the module from the VfsFat copies the 4 kB string into RAM
+print(ram_used - rom_used > 4000)
+
+sys.path.insert(0, "/rom/lib")
+print(__import__("pymod").y)
+sys.path.pop(0)
+
+os.umount("/ramdisk")
+os.umount("/rom")
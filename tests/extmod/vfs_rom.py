@@ -67,9 +67,11 @@ class VfsRomWriter:
     ROMFS_RECORD_KIND_DATA_POINTER = 3
     ROMFS_RECORD_KIND_DIRECTORY = 4
     ROMFS_RECORD_KIND_FILE = 5
+    ROMFS_RECORD_KIND_DIRECTORY_INDEX = 6
 
-    def __init__(self):
-        self._dir_stack = [(None, bytearray())]
+    def __init__(self, index=False):
+        self._index = index
+        self._dir_stack = [(None, bytearray(), [])]
 
     def _encode_uint(self, value):
         encoded = [value & 0x7F]
@@ -87,8 +89,29 @@ class VfsRomWriter:
         buf.extend(data)
         return len(buf)
 
+    def _extend_entry(self, name, data):
+        _, buf, entries = self._dir_stack[-1]
+        entries.append((name, len(buf)))
+        buf.extend(data)
+
+    def _popdir(self):
+        dirname, dirdata, entries = self._dir_stack.pop()
+        if self._index and entries:
+            # Insert an index of the entries before the first of them.
+            start = entries[0][1]
+            offsets = sorted((name, offset - start) for name, offset in entries)
+            size = 1
+            while max(offset for _, offset in offsets) >> (8 * size):
+                size += 1
+            index = self._encode_uint(len(offsets)) + self._encode_uint(size)
+            for _, offset in offsets:
+                index += offset.to_bytes(size, "big")
+            index = self._pack(VfsRomWriter.ROMFS_RECORD_KIND_DIRECTORY_INDEX, index)
+            dirdata = dirdata[:start] + index + dirdata[start:]
+        return dirname, dirdata
+
     def finalise(self):
-        _, data = self._dir_stack.pop()
+        _, data = self._popdir()
         encoded_kind = VfsRomWriter.ROMFS_HEADER
         encoded_len = self._encode_uint(len(data))
         if (len(encoded_kind) + len(encoded_len) + len(data)) % 2 == 1:
@@ -97,12 +120,13 @@ class VfsRomWriter:
         return data
 
     def opendir(self, dirname):
-        self._dir_stack.append((dirname, bytearray()))
+        self._dir_stack.append((dirname, bytearray(), []))
 
     def closedir(self):
-        dirname, dirdata = self._dir_stack.pop()
-        dirdata = self._encode_uint(len(dirname)) + bytes(dirname, "ascii") + dirdata
-        self._extend(self._pack(VfsRomWriter.ROMFS_RECORD_KIND_DIRECTORY, dirdata))
+        dirname, dirdata = self._popdir()
+        dirname = bytes(dirname, "ascii")
+        dirdata = self._encode_uint(len(dirname)) + dirname + dirdata
+        self._extend_entry(dirname, self._pack(VfsRomWriter.ROMFS_RECORD_KIND_DIRECTORY, dirdata))
 
     def mkdata(self, data):
         assert len(self._dir_stack) == 1
@@ -121,7 +145,7 @@ class VfsRomWriter:
             payload += self._pack(VfsRomWriter.ROMFS_RECORD_KIND_DATA_POINTER, sub_payload)
         else:
             payload += self._pack(VfsRomWriter.ROMFS_RECORD_KIND_DATA_VERBATIM, filedata)
-        self._dir_stack[-1][1].extend(self._pack(VfsRomWriter.ROMFS_RECORD_KIND_FILE, payload))
+        self._extend_entry(filename, self._pack(VfsRomWriter.ROMFS_RECORD_KIND_FILE, payload))
 
 
 def _make_romfs(fs, files, data_map):
@@ -136,8 +160,8 @@ def _make_romfs(fs, files, data_map):
             fs.mkfile(filename, contents)
 
 
-def make_romfs(files, data=None):
-    fs = VfsRomWriter()
+def make_romfs(files, data=None, index=False):
+    fs = VfsRomWriter(index)
     data_map = {}
     if data:
         for k, v in data.items():
@@ -296,6 +320,67 @@ class TestCorrupt(unittest.TestCase):
             fs.stat("file")
 
 
+class TestIndex(unittest.TestCase):
+    def test_index(self):
+        files = (
+            ("b.txt", b"b"),
+            ("a.txt", b"a"),
+            ("lib", tuple(("m{}.py".format(i), bytes(i)) for i in range(300))),
+            ("c", (("x", b"x"),)),
+        )
+        romfs = make_romfs(files)
+        romfs_index = make_romfs(files, index=True)
+        self.assertGreater(len(romfs_index), len(romfs))
+        fs = vfs.VfsRom(romfs_index)
+        self.assertEqual(
+            [x[:2] for x in fs.ilistdir("")], [x[:2] for x in vfs.VfsRom(romfs).ilistdir("")]
+        )
+        self.assertEqual(len(list(fs.ilistdir("lib"))), 300)
+        self.assertEqual(fs.stat("/a.txt")[6], 1)
+        self.assertEqual(fs.stat("b.txt")[6], 1)
+        self.assertEqual(fs.stat("/c/")[0], IFDIR)
+        for i in range(300):
+            self.assertEqual(fs.stat("/lib/m{}.py".format(i))[6], i)
+        with fs.open("/c/x", "rb") as f:
+            self.assertEqual(f.read(), b"x")
+        for path in ("/", "lib", "/lib/"):
+            self.assertEqual(fs.stat(path)[0], IFDIR)
+        for path in ("/0", "/a", "/a.txt/", "/d", "/lib/m", "/lib/m300.py", "/c/x/y"):
+            with self.assertRaises(OSError):
+                fs.stat(path)
+
+    def test_index_is_used(self):
+        # An index listing only the first file hides the second from lookups.
+        fs = VfsRomWriter()
+        index = b"\x01\x01\x00"
+        fs._extend(fs._pack(VfsRomWriter.ROMFS_RECORD_KIND_DIRECTORY_INDEX, index))
+        fs.mkfile("a", b"1")
+        fs.mkfile("b", b"2")
+        fs = vfs.VfsRom(fs.finalise())
+        self.assertEqual([x[0] for x in fs.ilistdir("")], ["a", "b"])
+        self.assertEqual(fs.stat("a")[6], 1)
+        with self.assertRaises(OSError):
+            fs.stat("b")
+
+    def test_corrupt_index(self):
+        # A corrupt index is ignored and the entries are scanned instead.
+        for index in (
+            b"",
+            b"\x01",
+            b"\x01\x00",
+            b"\x01\x05\x00\x00\x00\x00\x00",
+            b"\x02\x01\x00",
+            b"\x01\x01\x7f",
+        ):
+            fs = VfsRomWriter()
+            fs._extend(fs._pack(VfsRomWriter.ROMFS_RECORD_KIND_DIRECTORY_INDEX, index))
+            fs.mkfile("a", b"1")
+            fs.mkfile("b", b"2")
+            fs = vfs.VfsRom(fs.finalise())
+            self.assertEqual(fs.stat("a")[6], 1)
+            self.assertEqual(fs.stat("b")[6], 1)
+
+
 class TestStandalone(TestBase):
     def test_constructor(self):
         self.assertIsInstance(vfs.VfsRom(self.romfs), vfs.VfsRom)
@@ -0,0 +1,51 @@
+# Test that allocations of several sizes into a fragmented heap keep their
+# contents, whether or not the holes they could use are before or after the
+# place the last allocation of another size was found.
+
+import gc
+
+gc.collect()
+
+
+def fill(n, size):
+    return [bytearray([i & 0xFF]) * size for i in range(n)]
+
+
+def check(objs, size):
+    for i, b in enumerate(objs):
+        if b is not None:
+            assert len(b) == size and b[0] == i & 0xFF and b[-1] == i & 0xFF, (i, size)
+
+
+# Leave holes of one size between live objects, then allocate other sizes.
+for hole, size in ((16, 40), (40, 16), (24, 24), (100, 8)):
+    objs = fill(150, hole)
+    for i in range(0, len(objs), 2):
+        objs[i] = None
+    gc.collect()
+    new = fill(100, size)
+    check(objs, hole)
+    check(new, size)
+print("holes")
+
+# Sizes that alternate between one block and several, with the heap not
+# collected in between, so the scans start where the last ones stopped.
+gc.disable()
+mixed = []
+for i in range(240):
+    size = (4, 40, 120)[i % 3]
+    mixed.append(bytearray([i & 0xFF]) * size)
+    if i % 5 == 0:
+        mixed[i // 2] = None
+gc.enable()
+for i, b in enumerate(mixed):
+    if b is not None:
+        assert len(b) == (4, 40, 120)[i % 3] and b[0] == i & 0xFF
+print("mixed")
+
+# Freeing lets an allocation larger than any earlier one reuse the space.
+objs = fill(100, 48)
+objs = None
+gc.collect()
+big = bytearray(100 * 48)
+print(len(big))
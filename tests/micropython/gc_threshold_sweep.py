@@ -0,0 +1,54 @@
+# Test that objects stay intact when collections are triggered by allocation,
+# so the heap is being allocated from and grown into while it is swept.
+
+import gc
+
+if not hasattr(gc, "threshold"):
+    print("SKIP")
+    raise SystemExit
+
+
+class Node:
+    def __init__(self, value, next):
+        self.value = value
+        self.next = next
+        self.buf = bytearray(value % 7 * 30)
+
+
+gc.collect()
+gc.threshold(2000)
+
+keep = []
+grow = []
+head = None
+for i in range(4000):
+    head = Node(i, head if i % 13 else None)
+    if i % 50 == 0:
+        keep.append(head)
+    if len(keep) > 20:
+        keep.pop(i % len(keep))
+    # Grow a list in place and by moving while collections are happening.
+    grow.append(i)
+    if len(grow) > 500:
+        grow = grow[250:]
+
+gc.threshold(-1)
+
+count = 0
+for node in keep:
+    while node:
+        assert len(node.buf) == node.value % 7 * 30
+        if node.next:
+            assert node.next.value == node.value - 1
+        count += 1
+        node = node.next
+print(count > 0)
+print(grow == list(range(grow[0], grow[0] + len(grow))))
+
+# Memory freed by a collection is reported straight away.
+big = [bytearray(100) for _ in range(50)]
+gc.collect()
+before = gc.mem_free()
+big = None
+gc.collect()
+print(gc.mem_free() > before)
@@ -0,0 +1,50 @@
+# Test rendering a synthesizer through a mixer into a buffer, without
+# returning to Python between blocks
+
+try:
+    import array
+    import audiocore
+    import audiomixer
+    import synthio
+
+    audiocore.render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def test(nframes, nvoices):
+    synth = synthio.Synthesizer(sample_rate=22050, channel_count=2)
+    synth.press(synthio.Note(frequency=110 * (i + 1), panning=i % 2 - 0.5) for i in range(nvoices))
+    mixer = audiomixer.Mixer(voice_count=1, sample_rate=22050, channel_count=2, buffer_size=2048)
+    mixer.voice[0].level = 0.5
+    mixer.voice[0].play(synth)
+    out = array.array("h", bytes(nframes * 4))
+    audiocore.render(mixer, out, reset=False)
+    return out
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (1024, 2),
+    (100, 10): (2048, 4),
+    (1000, 100): (65536, 8),
+    (5000, 100): (262144, 12),
+}
+
+
+def bm_setup(params):
+    nframes, nvoices = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nframes, nvoices)
+
+    def result():
+        # The result can't be checked against CPython, which has no audiocore.
+        return nframes * nvoices, None
+
+    return run, result
@@ -0,0 +1,49 @@
+# Test mixing several looping samples with audiomixer
+
+try:
+    import array
+    import audiocore
+    import audiomixer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test(nblocks, nvoices):
+    mixer = audiomixer.Mixer(
+        voice_count=nvoices, buffer_size=4096, channel_count=2, sample_rate=44100
+    )
+    data = array.array("h", [(i * 1237) % 20000 - 10000 for i in range(2048)])
+    sample = audiocore.RawSample(data, channel_count=2, sample_rate=44100)
+    for i in range(nvoices):
+        mixer.voice[i].level = 0.5
+        mixer.voice[i].play(sample, loop=True)
+    for i in range(nblocks):
+        audiocore.get_buffer(mixer)
+    return nblocks
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (16, 2),
+    (100, 10): (32, 4),
+    (1000, 100): (1024, 8),
+    (5000, 100): (4096, 8),
+}
+
+
+def bm_setup(params):
+    nblocks, nvoices = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nblocks, nvoices)
+
+    def result():
+        # The result can't be checked against CPython, which has no audiomixer.
+        return nblocks * nvoices, None
+
+    return run, result
@@ -0,0 +1,54 @@
+# Test displayio.Bitmap pixel access and bitmaptools drawing, as used to build display UIs
+
+try:
+    import displayio
+    import bitmaptools
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test(niter, width, height):
+    bitmap = displayio.Bitmap(width, height, 256)
+    sprite = displayio.Bitmap(16, 16, 256)
+    for y in range(16):
+        for x in range(16):
+            sprite[x, y] = x ^ y
+    for n in range(niter):
+        for y in range(0, height, 4):
+            for x in range(width):
+                bitmap[x, y] = (x + y + n) & 0xFF
+        bitmaptools.fill_region(bitmap, 0, 0, width // 2, height // 2, n & 0xFF)
+        bitmaptools.draw_line(bitmap, 0, 0, width - 1, height - 1, 7)
+        for x in range(0, width - 16, 8):
+            bitmaptools.blit(bitmap, sprite, x, (x + n) % (height - 16), skip_source_index=0)
+        total = 0
+        for x in range(width):
+            total += bitmap[x, height // 2]
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (2, 32, 32),
+    (100, 10): (4, 32, 32),
+    (1000, 100): (100, 128, 96),
+    (5000, 100): (500, 128, 96),
+}
+
+
+def bm_setup(params):
+    niter, width, height = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter, width, height)
+
+    def result():
+        # The result can't be checked against CPython, which has no displayio.
+        return niter * width * height, None
+
+    return run, result
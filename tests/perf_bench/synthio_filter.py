@@ -0,0 +1,51 @@
+# Test rendering synthio voices that each have their own biquad filter
+
+try:
+    import audiocore
+    import synthio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test(nblocks, nvoices):
+    synth = synthio.Synthesizer(sample_rate=22050, channel_count=2)
+    sweep = synthio.LFO(rate=0.5, scale=400, offset=1200)
+    notes = [
+        synthio.Note(
+            frequency=55 * (i + 1),
+            panning=(i % 3 - 1) * 0.5,
+            filter=synthio.Biquad(synthio.FilterMode.LOW_PASS, sweep, Q=2),
+        )
+        for i in range(nvoices)
+    ]
+    synth.press(notes)
+    for i in range(nblocks):
+        audiocore.get_buffer(synth)
+    return nblocks
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (64, 2),
+    (100, 10): (128, 4),
+    (1000, 100): (4096, 8),
+    (5000, 100): (16384, 12),
+}
+
+
+def bm_setup(params):
+    nblocks, nvoices = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nblocks, nvoices)
+
+    def result():
+        # The result can't be checked against CPython, which has no synthio.
+        return nblocks * nvoices, None
+
+    return run, result
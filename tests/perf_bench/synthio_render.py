@@ -0,0 +1,54 @@
+# Test rendering synthio voices with envelopes and LFOs
+
+try:
+    import audiocore
+    import synthio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test(nblocks, nvoices):
+    envelope = synthio.Envelope(attack_time=0.01, decay_time=0.05, sustain_level=0.6)
+    synth = synthio.Synthesizer(sample_rate=22050, channel_count=2, envelope=envelope)
+    vibrato = synthio.LFO(rate=5, scale=0.01)
+    notes = [
+        synthio.Note(
+            frequency=110 * (i + 1), bend=vibrato, panning=synthio.LFO(rate=0.5 + i, scale=1)
+        )
+        for i in range(nvoices)
+    ]
+    synth.press(notes)
+    for i in range(nblocks):
+        audiocore.get_buffer(synth)
+        if i % 64 == 32:
+            synth.release(notes[: nvoices // 2])
+        elif i % 64 == 0:
+            synth.press(notes[: nvoices // 2])
+    return nblocks
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (64, 2),
+    (100, 10): (128, 4),
+    (1000, 100): (4096, 8),
+    (5000, 100): (16384, 12),
+}
+
+
+def bm_setup(params):
+    nblocks, nvoices = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nblocks, nvoices)
+
+    def result():
+        # The result can't be checked against CPython, which has no synthio.
+        return nblocks * nvoices, None
+
+    return run, result
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+
+# This file is part of the CircuitPython project: https://circuitpython.org
+#
+# SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries
+#
+# SPDX-License-Identifier: MIT
+
+# Build the unix "perf" variant once for each combination of the MICROPY_OPT_* speed
+# options and run the performance benchmarks against each build with
+# run-perfbench-table.py, so the options can be compared on CircuitPython workloads.
+
+import argparse
+import itertools
+import os
+import subprocess
+import sys
+
+UNIX_PORT_DIR = "../ports/unix"
+BENCH_SCRIPT_DIR = "perf_bench/"
+
+# Make variable in variants/perf/mpconfigvariant.mk, short name for reports.
+OPTIONS = (
+    ("OPT_COMPUTED_GOTO", "goto"),
+    ("OPT_INSTANCE_SHAPES", "shapes"),
+    ("OPT_LOAD_ATTR_FAST_PATH", "attr"),
+    ("OPT_MAP_LOOKUP_CACHE", "cache"),
+    ("OPT_SITE_LOOKUP_CACHE", "site"),
+)
+
+# Benchmark suites to run. displayio_* and synthio_* need the modules in the perf variant.
+SUITES = ("bm_", "misc_", "displayio_", "synthio_")
+
+
+def build(values, jobs, make_args):
+    build_dir = "build-perf-" + "".join(str(v) for v in values)
+    cmd = ["make", "-C", UNIX_PORT_DIR, "-j%d" % jobs, "VARIANT=perf", "BUILD=" + build_dir]
+    cmd += ["%s=%d" % (option, v) for (option, _), v in zip(OPTIONS, values)]
+    cmd += make_args
+    print(" ".join(cmd))
+    subprocess.run(cmd, check=True)
+    return os.path.join(UNIX_PORT_DIR, build_dir, "micropython")
+
+
+def main():
+    cmd_parser = argparse.ArgumentParser(
+        description="Benchmark each combination of MicroPython speed options on the unix port"
+    )
+    cmd_parser.add_argument("-a", "--average", default="8", help="averaging number")
+    cmd_parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(), help="make jobs")
+    cmd_parser.add_argument(
+        "--make-arg", action="append", default=[], help="extra argument to pass to make"
+    )
+    cmd_parser.add_argument("N", nargs="?", default="1000", help="N parameter (CPU frequency)")
+    cmd_parser.add_argument("M", nargs="?", default="1000", help="M parameter (heap in kbytes)")
+    cmd_parser.add_argument("files", nargs="*", help="input test files (default: all suites)")
+    args = cmd_parser.parse_args()
+
+    if args.files:
+        tests = sorted(args.files)
+    else:
+        tests = sorted(
+            BENCH_SCRIPT_DIR + test_file
+            for test_file in os.listdir(BENCH_SCRIPT_DIR)
+            if test_file.endswith(".py") and test_file.startswith(SUITES)
+        )
+
+    for values in itertools.product((0, 1), repeat=len(OPTIONS)):
+        micropython = build(values, args.jobs, args.make_arg)
+        print(" ".join("%s=%d" % (name, v) for (_, name), v in zip(OPTIONS, values)))
+        sys.stdout.flush()
+        env = dict(os.environ, MICROPY_MICROPYTHON=micropython)
+        subprocess.run(
+            [sys.executable, "run-perfbench-table.py", "-a", args.average, args.N, args.M]
+            + tests,
+            env=env,
+            check=True,
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -91,6 +91,8 @@ def run_feature_test(target, test):
 def run_benchmark_on_target(target, script, run_command=None):
     output, err, runtime_us = run_script_on_target(target, script, run_command)
     if err is None:
+        if output == "SKIP":
+            return -1, -1, "SKIP", runtime_us
         time, norm, result = output.split(None, 2)
         try:
             return int(time), int(norm), result, runtime_us
@@ -170,8 +172,8 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
 
         if error is not None:
             print(test_file, error)
-            if error == "no matching params":
-                table.add_row(test_file, *([None] * 3))
+            if error.startswith("SKIP"):
+                table.add_row(test_file, *(["skip"] * 3))
             else:
                 table.add_row(test_file, *(["error"] * 3))
         else:
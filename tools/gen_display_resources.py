@@ -206,6 +206,7 @@ displayio_palette_t blinka_palette = {{
     .base = {{.type = &displayio_palette_type }},
     .colors = blinka_colors,
     .color_count = 7,
+    .transparent_count = 1,
     .needs_refresh = false
 }};
 